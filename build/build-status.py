@@ -0,0 +1,8 @@
+#! /usr/bin/env python
+
+# Programs that are runnable.
+ns3_runnable_programs = ['build/scratch/ns3-dev-evaluate_fst_mechanism-debug', 'build/scratch/ns3-dev-evaluate_service_period_udp-debug', 'build/scratch/ns3-dev-evaluate_beamforming_cbap-debug', 'build/scratch/ns3-dev-evaluate_spatial_sharing_udp-debug', 'build/scratch/ns3-dev-evaluate_dynamic_allocation2-debug', 'build/scratch/ns3-dev-evaluate_halfduplex_relay-debug', 'build/scratch/ns3-dev-evaluate_custom_analytical_codebook-debug', 'build/scratch/ns3-dev-evaluate_beacon_interval-debug', 'build/scratch/ns3-dev-evaluate_dmg_rate_adaptation-debug', 'build/scratch/ns3-dev-evaluate_simple_service_period-debug', 'build/scratch/ns3-dev-evaluate_dmg_error_model-debug', 'build/scratch/ns3-dev-evaluate_fullduplex_relay-debug', 'build/scratch/ns3-dev-evaluate_spatial_sharing-debug', 'build/scratch/ns3-dev-evaluate_qd_channel_lroom_scenario-debug', 'build/scratch/ns3-dev-compare_access_schemes-debug', 'build/scratch/ns3-dev-evaluate_halfduplex_relay_tcp-debug', 'build/scratch/ns3-dev-evaluate_beamforming_sp-debug', 'build/scratch/ns3-dev-evaluate_decentralized_clustering-debug', 'build/scratch/ns3-dev-evaluate_bti_beamforming-debug', 'build/scratch/subdir/ns3-dev-subdir-debug', 'build/scratch/ns3-dev-test_beamformedlink_maintenance-debug', 'build/scratch/ns3-dev-evaluate_service_period_tcp-debug', 'build/scratch/ns3-dev-evaluate_dmg_adhoc-debug', 'build/scratch/ns3-dev-evaluate_beamforming_sp2-debug', 'build/scratch/ns3-dev-evaluate_halfduplex_relay_udp-debug', 'build/scratch/ns3-dev-evaluate_trafficstream_allocation-debug', 'build/scratch/ns3-dev-evaluate_qd_channel_spatial_sharing-debug', 'build/scratch/ns3-dev-zz_smoke-debug', 'build/scratch/ns3-dev-evaluate_service_period-debug', 'build/scratch/ns3-dev-evaluate_qd_dense_scenario_single_ap-debug', 'build/scratch/ns3-dev-evaluate_relay_operation-debug', 'build/scratch/ns3-dev-evaluate_numerical_codebook-debug', 'build/scratch/ns3-dev-evaluate_dynamic_allocation-debug']
+
+# Scripts that are runnable.
+ns3_runnable_scripts = []
+
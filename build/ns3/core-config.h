@@ -0,0 +1,21 @@
+/* WARNING! All changes made to this file will be lost! */
+
+#ifndef W_NS3_CORE_CONFIG_H_WAF
+#define W_NS3_CORE_CONFIG_H_WAF
+
+/* #undef HAVE_UINT128_T */
+#define HAVE___UINT128_T 1
+#define INT64X64_USE_128 1
+#define HAVE_STDINT_H 1
+#define HAVE_INTTYPES_H 1
+/* #undef HAVE_SYS_INT_TYPES_H */
+#define HAVE_SYS_TYPES_H 1
+#define HAVE_SYS_STAT_H 1
+#define HAVE_DIRENT_H 1
+#define HAVE_STDLIB_H 1
+#define HAVE_GETENV 1
+#define HAVE_SIGNAL_H 1
+#define HAVE_PTHREAD_H 1
+#define HAVE_RT 1
+
+#endif /* W_NS3_CORE_CONFIG_H_WAF */
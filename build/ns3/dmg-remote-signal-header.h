@@ -0,0 +1,146 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2015-2019 IMDEA Networks Institute
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+
+#ifndef DMG_REMOTE_SIGNAL_HEADER_H
+#define DMG_REMOTE_SIGNAL_HEADER_H
+
+#include "ns3/header.h"
+#include "ns3/nstime.h"
+#include "ampdu-tag.h"
+#include "dmg-wifi-phy.h"
+#include "wifi-phy-tag.h"
+
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \ingroup wifi
+ *
+ * Header describing a DMG signal which is transmitted on one MPI task and
+ * received by the DmgWifiPhy objects of another task.
+ *
+ * The header carries the transmission parameters (tx power, duration and
+ * TXVECTOR) and, for every receiver of the remote task, the propagation
+ * delay and the gain of the transmit antenna towards the receiver. The
+ * gain is computed by the sender with its current sector or AWV, so the
+ * receiving task does not need the state of the codebook of the sender.
+ * The packet tags read by the PHY, which are not serialized by the
+ * packet, are carried by the header as well.
+ */
+class DmgRemoteSignalHeader : public Header
+{
+public:
+  /**
+   * A receiver of the signal on the remote task.
+   */
+  struct Receiver
+  {
+    uint32_t phyIndex;        //!< The index of the receiver in the channel.
+    double txAntennaGainDbi;  //!< The gain of the transmit antenna towards the receiver.
+    Time delay;               //!< The propagation delay from the sender to the receiver.
+  };
+
+  typedef std::vector<Receiver> ReceiverList;
+  typedef ReceiverList::const_iterator ReceiverListCI;
+
+  DmgRemoteSignalHeader ();
+  virtual ~DmgRemoteSignalHeader ();
+
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+  virtual TypeId GetInstanceTypeId (void) const;
+  virtual void Print (std::ostream &os) const;
+  virtual uint32_t GetSerializedSize (void) const;
+  virtual void Serialize (Buffer::Iterator start) const;
+  virtual uint32_t Deserialize (Buffer::Iterator start);
+
+  /**
+   * \param type the PLCP field carried by the signal (the whole PPDU or a TRN subfield).
+   */
+  void SetFieldType (PLCP_FIELD_TYPE type);
+  /**
+   * \param index the index of the sender in the channel.
+   */
+  void SetSenderIndex (uint32_t index);
+  /**
+   * \param txTime the time at which the signal is transmitted.
+   */
+  void SetTxTime (Time txTime);
+  /**
+   * \param txPowerDbm the tx power of the signal in dBm.
+   */
+  void SetTxPowerDbm (double txPowerDbm);
+  /**
+   * \param duration the duration of the signal.
+   */
+  void SetDuration (Time duration);
+  /**
+   * \param tag the tag holding the TXVECTOR of the signal.
+   */
+  void SetWifiPhyTag (const WifiPhyTag &tag);
+  /**
+   * \param tag the tag of the MPDU if it is part of an A-MPDU.
+   */
+  void SetAmpduTag (const AmpduTag &tag);
+  /**
+   * Add a receiver of the signal.
+   * \param phyIndex the index of the receiver in the channel.
+   * \param txAntennaGainDbi the gain of the transmit antenna towards the receiver.
+   * \param delay the propagation delay from the sender to the receiver.
+   */
+  void AddReceiver (uint32_t phyIndex, double txAntennaGainDbi, Time delay);
+
+  PLCP_FIELD_TYPE GetFieldType (void) const;
+  uint32_t GetSenderIndex (void) const;
+  Time GetTxTime (void) const;
+  double GetTxPowerDbm (void) const;
+  Time GetDuration (void) const;
+  WifiPhyTag GetWifiPhyTag (void) const;
+  /**
+   * \param tag the tag of the MPDU if it is part of an A-MPDU.
+   * \return true if the MPDU is part of an A-MPDU.
+   */
+  bool GetAmpduTag (AmpduTag &tag) const;
+  const ReceiverList & GetReceivers (void) const;
+  /**
+   * \return the shortest propagation delay to the receivers of the signal.
+   */
+  Time GetMinimumDelay (void) const;
+
+private:
+  PLCP_FIELD_TYPE m_fieldType;  //!< The PLCP field carried by the signal.
+  uint32_t m_senderIndex;       //!< The index of the sender in the channel.
+  Time m_txTime;                //!< The transmission time.
+  double m_txPowerDbm;          //!< The tx power in dBm.
+  Time m_duration;              //!< The duration of the signal.
+  WifiPhyTag m_phyTag;          //!< The TXVECTOR of the signal.
+  bool m_isAmpdu;               //!< Flag to indicate if the MPDU is part of an A-MPDU.
+  AmpduTag m_ampduTag;          //!< The A-MPDU tag of the MPDU.
+  ReceiverList m_receivers;     //!< The receivers on the remote task.
+
+};
+
+} // namespace ns3
+
+#endif /* DMG_REMOTE_SIGNAL_HEADER_H */
@@ -0,0 +1,169 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2015-2019 IMDEA Networks Institute
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+#ifndef DMG_STATION_TABLE_H
+#define DMG_STATION_TABLE_H
+
+#include "ns3/mac48-address.h"
+
+#include "codebook.h"
+#include "dmg-capabilities.h"
+#include "wifi-information-element.h"
+
+#include <map>
+#include <vector>
+
+namespace ns3 {
+
+/* The largest AID indexed by the station table */
+#define DMG_STATION_TABLE_MAX_AID   255
+
+typedef std::pair<SectorID, AntennaID> ANTENNA_CONFIGURATION;   /* Typedef for antenna Config (SectorID, AntennaID) */
+typedef std::pair<Ptr<DmgCapabilities>, WifiInformationElementMap> StationInformation;
+
+/* Data Forwarding Information */
+typedef struct {
+  Mac48Address nextHopAddress;
+  bool isCbapPeriod;
+} AccessPeriodInformation;
+
+/* Link Maintenance Information */
+struct BeamLinkMaintenanceInfo {
+  uint32_t negotiatedValue;                               //!< Negotiated link maintenance value.
+  uint32_t beamLinkMaintenanceTime;
+};
+
+/**
+ * \ingroup wifi
+ *
+ * Record holding all the state a DMG STA keeps about one of its peers.
+ */
+struct DmgStationRecord
+{
+  Mac48Address address;                                   //!< The MAC address of the peer station.
+  uint16_t aid;                                           //!< The AID of the peer station.
+  bool hasAddress;                                        //!< Flag to indicate that the MAC address is known.
+  bool hasAid;                                            //!< Flag to indicate that the AID is known.
+  bool hasInformation;                                    //!< Flag to indicate that the information field is valid.
+  bool hasForwarding;                                     //!< Flag to indicate that the forwarding field is valid.
+  bool hasLinkMaintenance;                                //!< Flag to indicate that the link maintenance field is valid.
+  bool hasSnr;                                            //!< Flag to indicate that the SNR field is valid.
+  StationInformation information;                         //!< DMG Capabilities and information elements of the peer.
+  AccessPeriodInformation forwarding;                     //!< Data forwarding entry towards the peer.
+  BeamLinkMaintenanceInfo linkMaintenance;                //!< Beamformed link maintenance information.
+  std::pair<std::map<ANTENNA_CONFIGURATION, double>,
+            std::map<ANTENNA_CONFIGURATION, double> > snr;  //!< SNR per Tx/Rx antenna configuration.
+};
+
+/**
+ * \ingroup wifi
+ *
+ * Table of the peer stations known by a DMG STA. Each peer is assigned a dense slot
+ * the first time it is seen (e.g. upon association) and all its state is kept in a
+ * single record. Records are found in constant time either by AID, through a direct
+ * index array since AIDs are small integers, or by MAC address, through a small
+ * open-addressing hash table.
+ *
+ * Pointers to records remain valid until the next insertion in the table.
+ */
+class DmgStationTable
+{
+public:
+  typedef std::vector<DmgStationRecord>::iterator Iterator;
+  typedef std::vector<DmgStationRecord>::const_iterator ConstIterator;
+
+  DmgStationTable ();
+
+  /**
+   * Find the record of a peer station.
+   * \param address The MAC address of the peer station.
+   * \return A pointer to the record or 0 if the station is unknown.
+   */
+  DmgStationRecord * Find (Mac48Address address);
+  const DmgStationRecord * Find (Mac48Address address) const;
+  /**
+   * Find the record of a peer station.
+   * \param aid The AID of the peer station.
+   * \return A pointer to the record or 0 if the station is unknown.
+   */
+  DmgStationRecord * FindByAid (uint16_t aid);
+  const DmgStationRecord * FindByAid (uint16_t aid) const;
+  /**
+   * Get the record of a peer station, a new record is created if the station is unknown.
+   * \param address The MAC address of the peer station.
+   * \return A reference to the record.
+   */
+  DmgStationRecord & Add (Mac48Address address);
+  /**
+   * Get the record of a peer station, a new record is created if the AID is unknown.
+   * \param aid The AID of the peer station.
+   * \return A reference to the record.
+   */
+  DmgStationRecord & AddByAid (uint16_t aid);
+  /**
+   * Map an AID to the MAC address of a peer station.
+   * \param aid The AID of the peer station.
+   * \param address The MAC address of the peer station.
+   */
+  void MapAid (uint16_t aid, Mac48Address address);
+  /**
+   * \param aid The AID of the peer station.
+   * \return The MAC address mapped to the AID, or an invalid address if the AID is unknown.
+   */
+  Mac48Address GetAddress (uint16_t aid) const;
+  /**
+   * \param address The MAC address of the peer station.
+   * \param aid The AID of the peer station if found.
+   * \return True if an AID is mapped to the MAC address.
+   */
+  bool GetAid (Mac48Address address, uint16_t &aid) const;
+  /**
+   * \return The number of records in the table.
+   */
+  uint32_t GetSize (void) const;
+  Iterator Begin (void);
+  Iterator End (void);
+  ConstIterator Begin (void) const;
+  ConstIterator End (void) const;
+  /**
+   * Remove all the records.
+   */
+  void Clear (void);
+
+private:
+  /**
+   * \param address The MAC address.
+   * \return The hash value of the MAC address.
+   */
+  static uint32_t Hash (Mac48Address address);
+  /**
+   * \param address The MAC address.
+   * \return The bucket holding the address or the empty bucket where it should be inserted.
+   */
+  uint32_t FindBucket (Mac48Address address) const;
+  /**
+   * Create a new record.
+   * \return The slot of the record.
+   */
+  uint16_t NewRecord (void);
+  /**
+   * Insert a MAC address in the hash table.
+   * \param address The MAC address.
+   * \param slot The slot of the record.
+   */
+  void InsertAddress (Mac48Address address, uint16_t slot);
+  /**
+   * Grow the hash table and re-insert all the addresses.
+   */
+  void Rehash (void);
+
+  std::vector<DmgStationRecord> m_records;  //!< Dense array of station records.
+  std::vector<uint16_t> m_buckets;          //!< Hash buckets holding slot + 1 (0 for an empty bucket).
+  uint16_t m_aidIndex[256];                 //!< Direct index from AID to slot + 1 (0 for an unknown AID).
+};
+
+} // namespace ns3
+
+#endif /* DMG_STATION_TABLE_H */
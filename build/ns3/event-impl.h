@@ -0,0 +1,111 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2005,2006 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Mathieu Lacage <mathieu.lacage@sophia.inria.fr>
+ */
+#ifndef EVENT_IMPL_H
+#define EVENT_IMPL_H
+
+#include <stdint.h>
+#include <cstddef>
+#include "simple-ref-count.h"
+
+/**
+ * \file
+ * \ingroup events
+ * ns3::EventImpl declarations.
+ */
+
+namespace ns3 {
+
+/**
+ * \ingroup events
+ * \brief A simulation event.
+ *
+ * Each subclass of this base class represents a simulation event. The
+ * Invoke() method will be called by the simulation engine
+ * when it reaches the time associated to this event. Most subclasses
+ * are usually created by one of the many Simulator::Schedule
+ * methods.
+ *
+ * The events are small, short-lived objects, so their memory is
+ * recycled by a pool: each thread keeps a free list per size class
+ * (multiples of 16 bytes up to 256 bytes) of the blocks released by
+ * the events it deleted, and allocates the new events from these
+ * lists before falling back to the global allocator. The pool is used
+ * by all the subclasses, including the ones of MakeEvent().
+ */
+class EventImpl : public SimpleRefCount<EventImpl>
+{
+public:
+  /** Default constructor. */
+  EventImpl ();
+  /** Destructor. */
+  virtual ~EventImpl () = 0;
+  /**
+   * Called by the simulation engine to notify the event that it is time
+   * to execute.
+   */
+  void Invoke (void);
+  /**
+   * Marks the event as 'canceled'. The event is not removed from
+   * the event list but the simulation engine will check its canceled status
+   * before calling Invoke().
+   */
+  void Cancel (void);
+  /**
+   * \returns true if the event has been canceled.
+   *
+   * Checked by the simulation engine before calling Invoke().
+   */
+  bool IsCancelled (void);
+  /**
+   * Allocate the memory of an event from the pool of the calling thread.
+   * \param [in] size The size of the event.
+   * \returns The allocated memory.
+   */
+  static void * operator new (size_t size);
+  /**
+   * Release the memory of an event to the pool of the calling thread.
+   * \param [in] ptr The memory of the event.
+   * \param [in] size The size of the event.
+   */
+  static void operator delete (void *ptr, size_t size);
+  /**
+   * Enable or disable the event pool, e.g., to benchmark it or to
+   * track the events with a memory checker. The events allocated
+   * while the pool is enabled may be released after it is disabled.
+   * \param [in] enabled Whether the event pool is used.
+   */
+  static void SetPoolEnabled (bool enabled);
+
+protected:
+  /**
+   * Implementation for Invoke().
+   *
+   * This typically calls a method or function pointer with the
+   * arguments bound by a call to one of the MakeEvent() functions.
+   */
+  virtual void Notify (void) = 0;
+
+private:
+  bool m_cancel;  /**< Has this event been cancelled. */
+};
+
+} // namespace ns3
+
+#endif /* EVENT_IMPL_H */
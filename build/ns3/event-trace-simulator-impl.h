@@ -0,0 +1,190 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2015-2019 IMDEA Networks Institute
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+
+#ifndef EVENT_TRACE_SIMULATOR_IMPL_H
+#define EVENT_TRACE_SIMULATOR_IMPL_H
+
+#include "simulator-impl.h"
+#include "event-impl.h"
+
+#include "ptr.h"
+
+#include <fstream>
+#include <istream>
+#include <string>
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::EventTraceSimulatorImpl declaration.
+ */
+
+namespace ns3 {
+
+/**
+ * \ingroup simulator
+ *
+ * Simulator implementation which records the stream of events handled by
+ * another simulator implementation.
+ *
+ * This implementation forwards every call to the implementation given by
+ * the \c Implementation attribute, and writes to the binary file given by the
+ * \c FileName attribute one record per operation on the event queue: the
+ * insertion of an event (with the insertion time, the event time, the context
+ * and the uid of the event), its cancellation or removal, and its execution.
+ * Replaying the records against a Scheduler reproduces the exact sequence of
+ * operations of the recorded run, e.g. with <tt>bench-simulator --replay</tt>.
+ *
+ * The file starts with the 8 bytes of TRACE_MAGIC, followed by records of
+ * RECORD_SIZE bytes in the byte order of the host. To record a run, select
+ * this implementation before creating the simulator:
+ *
+ * \code
+ *   GlobalValue::Bind ("SimulatorImplementationType", StringValue ("ns3::EventTraceSimulatorImpl"));
+ *   Config::SetDefault ("ns3::EventTraceSimulatorImpl::FileName", StringValue ("dense.events"));
+ * \endcode
+ *
+ * The executions are recorded by wrapping each event, so recording slows the
+ * simulation down. Events scheduled concurrently by several threads are not
+ * supported.
+ */
+class EventTraceSimulatorImpl : public SimulatorImpl
+{
+public:
+  /**
+   *  Register this type.
+   *  \return The object TypeId.
+   */
+  static TypeId GetTypeId (void);
+
+  /** Constructor. */
+  EventTraceSimulatorImpl ();
+  /** Destructor. */
+  ~EventTraceSimulatorImpl ();
+
+  /** The type of a record. */
+  enum RecordType
+  {
+    INSERT = 0,          //!< Event inserted by Schedule or ScheduleNow.
+    INSERT_CONTEXT = 1,  //!< Event inserted by ScheduleWithContext, its uid is unknown.
+    CANCEL = 2,          //!< Event cancelled, it stays in the event queue.
+    REMOVE = 3,          //!< Event removed from the event queue.
+    EXECUTE = 4          //!< Next event removed from the event queue and executed.
+  };
+
+  /** A record of the trace. */
+  struct Record
+  {
+    RecordType type;     //!< The type of the record.
+    uint64_t now;        //!< The simulation time of the operation, in time steps.
+    uint64_t ts;         //!< The time of the event, in time steps.
+    uint32_t context;    //!< The context of the event.
+    uint32_t uid;        //!< The uid of the event, zero if unknown.
+  };
+
+  /** The identifier at the start of a trace file. */
+  static const char TRACE_MAGIC[8];
+  /** The size of a record in a trace file, in bytes. */
+  static const uint32_t RECORD_SIZE = 1 + 8 + 8 + 4 + 4;
+
+  /**
+   * Read the identifier at the start of a trace file.
+   * \param [in] is The stream of the trace file.
+   * \return \c true if the stream is a trace file.
+   */
+  static bool ReadHeader (std::istream &is);
+  /**
+   * Read the next record of a trace file.
+   * \param [in] is The stream of the trace file.
+   * \param [out] record The record.
+   * \return \c false at the end of the file.
+   */
+  static bool ReadRecord (std::istream &is, Record &record);
+
+  // Inherited
+  virtual void Destroy ();
+  virtual bool IsFinished (void) const;
+  virtual void Stop (void);
+  virtual void Stop (const Time &delay);
+  virtual EventId Schedule (const Time &delay, EventImpl *event);
+  virtual void ScheduleWithContext (uint32_t context, const Time &delay, EventImpl *event);
+  virtual EventId ScheduleNow (EventImpl *event);
+  virtual EventId ScheduleDestroy (EventImpl *event);
+  virtual void Remove (const EventId &id);
+  virtual void Cancel (const EventId &id);
+  virtual bool IsExpired (const EventId &id) const;
+  virtual void Run (void);
+  virtual Time Now (void) const;
+  virtual Time GetDelayLeft (const EventId &id) const;
+  virtual Time GetMaximumSimulationTime (void) const;
+  virtual void SetScheduler (ObjectFactory schedulerFactory);
+  virtual uint32_t GetSystemId (void) const;
+  virtual uint32_t GetContext (void) const;
+
+private:
+  virtual void NotifyConstructionCompleted (void);
+  virtual void DoDispose (void);
+
+  /**
+   * Event recording its execution before executing the wrapped event.
+   */
+  class TracedEvent : public EventImpl
+  {
+  public:
+    /**
+     * Constructor.
+     * \param [in] sim The simulator implementation recording the event.
+     * \param [in] event The wrapped event, whose reference is taken over.
+     */
+    TracedEvent (EventTraceSimulatorImpl *sim, EventImpl *event);
+
+  protected:
+    virtual void Notify (void);
+
+  private:
+    EventTraceSimulatorImpl *m_sim;   //!< The simulator implementation recording the event.
+    Ptr<EventImpl> m_event;           //!< The wrapped event.
+  };
+
+  /**
+   * Write a record to the trace file.
+   * \param [in] type The type of the record.
+   * \param [in] ts The time of the event, in time steps.
+   * \param [in] context The context of the event.
+   * \param [in] uid The uid of the event.
+   */
+  void Write (RecordType type, uint64_t ts, uint32_t context, uint32_t uid);
+  /**
+   * Write the record of an event identified by its EventId.
+   * \param [in] type The type of the record.
+   * \param [in] id The event.
+   */
+  void Write (RecordType type, const EventId &id);
+
+  Ptr<SimulatorImpl> m_impl;      //!< The recorded simulator implementation.
+  std::string m_implType;         //!< The type of the recorded simulator implementation.
+  std::string m_fileName;         //!< The name of the trace file.
+  std::ofstream m_file;           //!< The trace file.
+  uint64_t m_records;             //!< The number of records written.
+};
+
+} // namespace ns3
+
+#endif /* EVENT_TRACE_SIMULATOR_IMPL_H */
@@ -0,0 +1,182 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Ghada Badawy <gbadawy@gmail.com>
+ */
+
+#ifndef MPDU_AGGREGATOR_H
+#define MPDU_AGGREGATOR_H
+
+#include "ns3/packet.h"
+#include "ns3/object.h"
+#include "ns3/traced-callback.h"
+#include "ampdu-subframe-header.h"
+
+namespace ns3 {
+
+class WifiMacHeader;
+
+/**
+ * \brief Aggregator used to construct A-MPDUs
+ * \ingroup wifi
+ */
+class MpduAggregator : public Object
+{
+public:
+  /**
+   * A list of deaggregated packets and their A-MPDU subframe headers.
+   */
+  typedef std::list<std::pair<Ptr<Packet>, AmpduSubframeHeader> > DeaggregatedMpdus;
+  /**
+   * A constant iterator for a list of deaggregated packets and their A-MPDU subframe headers.
+   */
+  typedef std::list<std::pair<Ptr<Packet>, AmpduSubframeHeader> >::const_iterator DeaggregatedMpdusCI;
+
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  MpduAggregator ();
+  virtual ~MpduAggregator ();
+
+  /**
+   * Sets the maximum A-MPDU size in bytes.
+   * Value 0 means that MPDU aggregation is disabled.
+   *
+   * \param maxSize the maximum A-MPDU size in bytes.
+   */
+  void SetMaxAmpduSize (uint32_t maxSize);
+  /**
+   * Returns the maximum A-MPDU size in bytes.
+   * Value 0 means that MPDU aggregation is disabled.
+   *
+   * \return the maximum A-MPDU size in bytes.
+   */
+  uint32_t GetMaxAmpduSize (void) const;
+
+  /**
+   * \param packet Packet we have to insert into <i>aggregatedPacket</i>.
+   * \param aggregatedPacket Packet that will contain <i>packet</i>, if aggregation is possible.
+   *
+   * \return true if <i>packet</i> can be aggregated to <i>aggregatedPacket</i>, false otherwise.
+   *
+   * Adds <i>packet</i> to <i>aggregatedPacket</i>. In concrete aggregator's implementation is
+   * specified how and if <i>packet</i> can be added to <i>aggregatedPacket</i>.
+   *
+   * <i>aggregatedPacket</i> only accounts for the length of the A-MPDU: the subframe is added as a
+   * zero-filled area and the content of <i>packet</i> is not copied. The subframes sent over the air
+   * are built by AddHeaderAndPad.
+   */
+  bool Aggregate (Ptr<const Packet> packet, Ptr<Packet> aggregatedPacket) const;
+  /**
+   * \param packet the packet we want to insert into <i>aggregatedPacket</i>.
+   * \param aggregatedPacket packet that will contain the packet of size <i>packetSize</i>, if aggregation is possible.
+   *
+   * This method performs a VHT/HE single MPDU aggregation.
+   */
+  void AggregateSingleMpdu (Ptr<const Packet> packet, Ptr<Packet> aggregatedPacket) const;
+  /**
+   * \param packet the packet we want to insert into <i>aggregatedPacket</i>.
+   * \param last true if it is the last packet.
+   * \param isSingleMpdu true if it is a single MPDU
+   *
+   * Adds A-MPDU subframe header and padding to each MPDU that is part of an A-MPDU before it is sent.
+   */
+  void AddHeaderAndPad (Ptr<Packet> packet, bool last, bool isSingleMpdu) const;
+  /**
+   * \param packetSize size of the packet we want to insert into <i>aggregatedPacket</i>.
+   * \param aggregatedPacket packet that will contain the packet of size <i>packetSize</i>, if aggregation is possible.
+   * \param blockAckSize size of the piggybacked block ack request
+   *
+   * \return true if the packet of size <i>packetSize</i> can be aggregated to <i>aggregatedPacket</i>, false otherwise.
+   *
+   * This method is used to determine if a packet could be aggregated to an A-MPDU without exceeding the maximum packet size.
+   */
+  bool CanBeAggregated (uint32_t packetSize, Ptr<Packet> aggregatedPacket, uint8_t blockAckSize) const;
+  /**
+   * \param packetSize size of the packet we want to insert into the A-MPDU.
+   * \param ampduSize the current size of the A-MPDU.
+   * \param blockAckSize size of the piggybacked block ack request
+   *
+   * \return true if the packet of size <i>packetSize</i> can be aggregated to an A-MPDU of size <i>ampduSize</i>, false otherwise.
+   *
+   * This method only relies on integer arithmetic so it can be called for each candidate MPDU.
+   */
+  bool CanBeAggregated (uint32_t packetSize, uint32_t ampduSize, uint16_t blockAckSize) const;
+  /**
+   * Notify that the construction of an A-MPDU is completed.
+   *
+   * \param nMpdus the number of MPDUs in the A-MPDU.
+   * \param mpduBytes the total size of the MPDUs in the A-MPDU.
+   * \param ampduSize the size of the A-MPDU, including the subframe headers and the padding.
+   * \param byteBudget the maximum size of the PSDU allowed by the PPDU duration limit.
+   */
+  void NotifyAmpduBuilt (uint8_t nMpdus, uint32_t mpduBytes, uint32_t ampduSize, uint32_t byteBudget) const;
+
+  /**
+   * Deaggregates an A-MPDU by removing the A-MPDU subframe header and padding.
+   *
+   * \param aggregatedPacket the aggregated packet
+   * \return list of deaggragted packets and their A-MPDU subframe headers
+   */
+  static DeaggregatedMpdus Deaggregate (Ptr<Packet> aggregatedPacket);
+
+  /**
+   * TracedCallback signature for A-MPDU construction. The aggregation efficiency of the
+   * PPDU is given by <i>mpduBytes</i> / <i>ampduSize</i> and the utilization of the byte
+   * budget by <i>ampduSize</i> / <i>byteBudget</i>.
+   *
+   * \param nMpdus the number of MPDUs in the A-MPDU.
+   * \param mpduBytes the total size of the MPDUs in the A-MPDU.
+   * \param ampduSize the size of the A-MPDU.
+   * \param byteBudget the maximum size of the PSDU allowed by the PPDU duration limit.
+   */
+  typedef void (* AmpduBuiltCallback)(uint8_t nMpdus, uint32_t mpduBytes, uint32_t ampduSize, uint32_t byteBudget);
+
+
+private:
+  /**
+   * \param packet the Packet
+   * \return padding that must be added to the end of an aggregated packet
+   *
+   * Calculates how much padding must be added to the end of an aggregated packet, after that a new packet is added.
+   * Each A-MPDU subframe is padded so that its length is multiple of 4 octets.
+   */
+  uint8_t CalculatePadding (Ptr<const Packet> packet) const;
+  /**
+   * \param size the size of the aggregated packet
+   * \return padding that must be added to the end of an aggregated packet of the given size
+   */
+  static uint8_t CalculatePadding (uint32_t size);
+  /**
+   * \param mpduSize the size of the MPDU carried by the subframe
+   * \param padding the padding to add before the subframe
+   * \param aggregatedPacket the A-MPDU the subframe is added to
+   *
+   * Accounts for a new A-MPDU subframe at the end of <i>aggregatedPacket</i>.
+   */
+  void AddSubframe (uint32_t mpduSize, uint8_t padding, Ptr<Packet> aggregatedPacket) const;
+
+  uint32_t m_maxAmpduLength; //!< Maximum length in bytes of A-MPDUs
+  TracedCallback<uint8_t, uint32_t, uint32_t, uint32_t> m_ampduBuiltTrace; //!< Trace source for the A-MPDUs built
+};
+
+}  //namespace ns3
+
+#endif /* MPDU_AGGREGATOR_H */
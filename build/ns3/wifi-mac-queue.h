@@ -0,0 +1,384 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2005, 2009 INRIA
+ * Copyright (c) 2009 MIRKO BANCHI
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Authors: Mathieu Lacage <mathieu.lacage@sophia.inria.fr>
+ *          Mirko Banchi <mk.banchi@gmail.com>
+ *          Stefano Avallone <stavallo@unina.it>
+ */
+
+#ifndef WIFI_MAC_QUEUE_H
+#define WIFI_MAC_QUEUE_H
+
+#include "ns3/queue.h"
+#include "ns3/traced-callback.h"
+#include "wifi-mac-queue-item.h"
+
+#include <list>
+#include <map>
+
+namespace ns3 {
+
+class QosBlockedDestinations;
+
+/**
+ * \ingroup wifi
+ *
+ * This queue implements the timeout procedure described in
+ * (Section 9.19.2.6 "Retransmit procedures" paragraph 6; IEEE 802.11-2012).
+ *
+ * When a packet is received by the MAC, to be sent to the PHY,
+ * it is queued in the internal queue after being tagged by the
+ * current time.
+ *
+ * When a packet is dequeued, the queue checks its timestamp
+ * to verify whether or not it should be dropped. If
+ * dot11EDCATableMSDULifetime has elapsed, it is dropped.
+ * Otherwise, it is returned to the caller.
+ *
+ * Besides the FIFO order, QoS data frames are indexed per (receiver address, TID)
+ * flow, so that the lookups by TID and receiver address done while building
+ * A-MSDUs and A-MPDUs only visit the head of the flow instead of scanning the
+ * whole queue. Packets whose lifetime expired are removed lazily when they reach
+ * the head of their flow.
+ *
+ * All the frames are also indexed per receiver address. A DMG service period is
+ * allocated to a single peer station, so the frames that it can carry are found
+ * in the queue of that receiver without scanning the frames that can only be
+ * sent during a CBAP or a service period with another peer.
+ */
+class WifiMacQueue : public Queue<WifiMacQueueItem>
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+  WifiMacQueue ();
+  ~WifiMacQueue ();
+
+  /// drop policy
+  enum DropPolicy
+  {
+    DROP_NEWEST,
+    DROP_OLDEST
+  };
+
+  /**
+   * Set the maximum delay before the packet is discarded.
+   *
+   * \param delay the maximum delay
+   */
+  void SetMaxDelay (Time delay);
+  /**
+   * Return the maximum delay before the packet is discarded.
+   *
+   * \return the maximum delay
+   */
+  Time GetMaxDelay (void) const;
+
+  /**
+   * Enqueue the given Wifi MAC queue item at the <i>end</i> of the queue.
+   *
+   * \param item the Wifi MAC queue item to be enqueued at the end
+   * \return true if success, false if the packet has been dropped
+   */
+  bool Enqueue (Ptr<WifiMacQueueItem> item);
+  /**
+   * Enqueue the given Wifi MAC queue item at the <i>front</i> of the queue.
+   *
+   * \param item the Wifi MAC queue item to be enqueued at the front
+   * \return true if success, false if the packet has been dropped
+   */
+  bool PushFront (Ptr<WifiMacQueueItem> item);
+  /**
+   * Dequeue the packet in the front of the queue.
+   *
+   * \return the packet
+   */
+  Ptr<WifiMacQueueItem> Dequeue (void);
+  /**
+   * Search and return, if present in the queue, the first packet having the
+   * address indicated by <i>type</i> equal to <i>addr</i>, and tid
+   * equal to <i>tid</i>. This method removes the packet from the queue.
+   * It is typically used by ns3::EdcaTxopN in order to perform correct MSDU
+   * aggregation (A-MSDU).
+   *
+   * \param tid the given TID
+   * \param type the given address type
+   * \param addr the given destination
+   *
+   * \return the packet
+   */
+  Ptr<WifiMacQueueItem> DequeueByTidAndAddress (uint8_t tid,
+                                                WifiMacHeader::AddressType type,
+                                                Mac48Address addr);
+  /**
+   * Search and return, if present in the queue, the first packet having the
+   * address indicated by <i>type</i> equal to <i>addr</i>, and tid
+   * equal to <i>tid</i>. This method removes the packet from the queue.
+   * It is typically used by ns3::EdcaTxopN in order to perform correct MSDU
+   * aggregation (A-MSDU).
+   *
+   * \param type the given address type
+   * \param addr the given destination
+   *
+   * \return the packet
+   */
+  Ptr<WifiMacQueueItem> DequeueByAddress (WifiMacHeader::AddressType type,
+                                          Mac48Address addr, const Ptr<QosBlockedDestinations> blockedPackets);
+  /**
+   * Return first available packet for transmission. A packet could be no available
+   * if it is a QoS packet with a tid and an address1 fields equal to <i>tid</i> and <i>addr</i>
+   * respectively that index a pending agreement in the BlockAckManager object.
+   * So that packet must not be transmitted until reception of an ADDBA response frame from station
+   * addressed by <i>addr</i>. This method removes the packet from queue.
+   *
+   * \param blockedPackets
+   *
+   * \return packet
+   */
+  Ptr<WifiMacQueueItem> DequeueFirstAvailable (const Ptr<QosBlockedDestinations> blockedPackets);
+  /**
+   * Peek the packet in the front of the queue. The packet is not removed.
+   *
+   * \return the packet
+   */
+  Ptr<const WifiMacQueueItem> Peek (void) const;
+  /**
+   * Search and return, if present in the queue, the first packet having the
+   * address indicated by <i>type</i> equal to <i>addr</i>, and tid
+   * equal to <i>tid</i>. This method does not remove the packet from the queue.
+   * It is typically used by ns3::EdcaTxopN in order to perform correct MSDU
+   * aggregation (A-MSDU).
+   *
+   * \param tid the given TID
+   * \param type the given address type
+   * \param addr the given destination
+   *
+   * \return packet
+   */
+  Ptr<const WifiMacQueueItem> PeekByTidAndAddress (uint8_t tid,
+                                                   WifiMacHeader::AddressType type,
+                                                   Mac48Address addr);
+  /**
+   * Return first available packet for transmission. The packet is not removed from queue.
+   *
+   * \param blockedPackets
+   *
+   * \return packet
+   */
+  Ptr<const WifiMacQueueItem> PeekFirstAvailable (const Ptr<QosBlockedDestinations> blockedPackets);
+
+  /**
+   * Return first available packet for transmission. The packet is not removed from queue.
+   *
+   * \param type The type of the address to check
+   * \param dest The destination MAC address.
+   * \param blockedPackets
+   *
+   * \return packet
+   */
+  Ptr<const WifiMacQueueItem> PeekFirstAvailableByAddress (WifiMacHeader::AddressType type,
+                                                           Mac48Address dest,
+                                                           const Ptr<QosBlockedDestinations> blockedPackets);
+
+  /**
+   * Remove the packet in the front of the queue.
+   *
+   * \return the packet
+   */
+  Ptr<WifiMacQueueItem> Remove (void);
+  /**
+   * If exists, removes <i>packet</i> from queue and returns true. Otherwise it
+   * takes no effects and return false. Deletion of the packet is
+   * performed in linear time (O(n)).
+   *
+   * \param packet the packet to be removed
+   *
+   * \return true if the packet was removed, false otherwise
+   */
+  bool Remove (Ptr<const Packet> packet);
+  /**
+   * Return the number of QoS packets having tid equal to <i>tid</i> and address
+   * specified by <i>type</i> equal to <i>addr</i>.
+   *
+   * \param tid the given TID
+   * \param type the given address type
+   * \param addr the given destination
+   *
+   * \return the number of QoS packets
+   */
+  uint32_t GetNPacketsByTidAndAddress (uint8_t tid,
+                                       WifiMacHeader::AddressType type,
+                                       Mac48Address addr);
+
+  /**
+   * \return true if the queue is empty; false otherwise
+   *
+   * Overrides the IsEmpty method provided by QueueBase
+   */
+  bool IsEmpty (void);
+
+  /**
+   * \return The number of packets currently stored in the Queue
+   *
+   * Overrides the GetNPackets method provided by QueueBase
+   */
+  uint32_t GetNPackets (void);
+
+  /**
+   * \return The number of bytes currently occupied by the packets in the Queue
+   *
+   * Overrides the GetNBytes method provided by QueueBase
+   */
+  uint32_t GetNBytes (void);
+
+  /**
+   * Transfer all the packets specified by the address to the destination Queue.
+   * \param addr The MAC Address of the receiver.
+   * \param destQueue Pointer to the destination queue.
+   */
+  void TransferPacketsByAddress (Mac48Address addr, Ptr<WifiMacQueue> destQueue);
+  void QuickTransfer (Ptr<WifiMacQueue> destQueue);
+  /**
+   * Change Packets Receiver Address.
+   * \param addr The MAC address of the old receiver.
+   * \param addr The MAC address of the new receiver.
+   */
+  void ChangePacketsReceiverAddress (Mac48Address OriginalAddress, Mac48Address newAddress);
+  /**
+   * Check whether the queue contains packets for the provided receiver address.
+   * \param addr The MAC Address of the receiver.
+   * \return true if the queue has at least one packet for the provided receiver address.
+   */
+  bool HasPacketsForReceiver (Mac48Address addr);
+  /**
+   * \param addr The MAC Address of the receiver.
+   * \return the number of packets in the queue for the provided receiver address.
+   */
+  uint32_t GetNPacketsForReceiver (Mac48Address addr);
+
+  /**
+   * TracedCallback signature for the backlog of a receiver.
+   *
+   * \param addr The MAC address of the receiver.
+   * \param packets The number of packets queued for the receiver.
+   */
+  typedef void (* BacklogTracedCallback)(Mac48Address addr, uint32_t packets);
+
+private:
+  /**
+   * Remove the item pointed to by the iterator <i>it</i> if it has been in the
+   * queue for too long. If the item is removed, the iterator is updated to
+   * point to the item that followed the erased one.
+   *
+   * \param it an iterator pointing to the item
+   * \return true if the item is removed, false otherwise
+   */
+  bool TtlExceeded (ConstIterator &it);
+
+  /// Flow identifier: the receiver address and the TID of QoS data frames
+  typedef std::pair<Mac48Address, uint8_t> FlowId;
+  /// The items of a flow in FIFO order
+  typedef std::list<ConstIterator> FlowQueue;
+  /// Map flows to their items
+  typedef std::map<FlowId, FlowQueue> Flows;
+  /// Map receiver addresses to their items, in FIFO order
+  typedef std::map<Mac48Address, FlowQueue> Receivers;
+
+  /**
+   * \param item the Wifi MAC queue item
+   * \param flow the flow of the item
+   * \return true if the item is a QoS data frame that belongs to a flow
+   */
+  static bool GetFlowId (Ptr<const WifiMacQueueItem> item, FlowId &flow);
+  /**
+   * Check whether the given lookup can be served by the flow index.
+   *
+   * \param type the given address type
+   * \return true if the lookup is by receiver address
+   */
+  static bool IsIndexed (WifiMacHeader::AddressType type);
+  /**
+   * Return the first item of a flow, after removing from the queue the items
+   * at the head of the flow that stayed in the queue for too long.
+   *
+   * \param tid the given TID
+   * \param addr the given receiver address
+   * \param it set to the position of the first item in the queue
+   * \return true if the flow has at least one item
+   */
+  bool GetFlowHead (uint8_t tid, Mac48Address addr, ConstIterator &it);
+  /**
+   * Return the first item for a receiver that satisfies the given QoS data
+   * frame lookup, after removing from the queue the items for that receiver
+   * that stayed in the queue for too long.
+   *
+   * \param addr the given receiver address
+   * \param blockedPackets the blocked destinations
+   * \param it set to the position of the item in the queue
+   * \return true if an item is found
+   */
+  bool GetFirstAvailableForReceiver (Mac48Address addr, const Ptr<QosBlockedDestinations> blockedPackets,
+                                     ConstIterator &it);
+  /**
+   * Remove the given item from the index of its flow and of its receiver.
+   *
+   * \param pos the position of the item in the queue
+   */
+  void RemoveFromIndex (ConstIterator pos);
+  /**
+   * Rebuild the flow and receiver indexes from the FIFO order of the queue.
+   */
+  void RebuildIndex (void);
+  /**
+   * Insert an item in the queue and in the indexes of its flow and receiver.
+   *
+   * \param pos the position before which the item is inserted
+   * \param item the item to insert
+   * \return true if success, false if the packet has been dropped
+   */
+  bool DoEnqueue (ConstIterator pos, Ptr<WifiMacQueueItem> item);
+  /**
+   * Dequeue an item from the queue and from the indexes of its flow and receiver.
+   *
+   * \param pos the position of the item
+   * \return the item
+   */
+  Ptr<WifiMacQueueItem> DoDequeue (ConstIterator pos);
+  /**
+   * Remove an item from the queue and from the indexes of its flow and receiver.
+   *
+   * \param pos the position of the item
+   * \return the item
+   */
+  Ptr<WifiMacQueueItem> DoRemove (ConstIterator pos);
+
+  Flows m_flows;                            //!< Per (receiver address, TID) index of the QoS data frames
+  Receivers m_receivers;                    //!< Per receiver address index of all the frames
+  TracedCallback<Mac48Address, uint32_t> m_backlogTrace; //!< Trace of the number of packets queued per receiver
+  Time m_maxDelay;                          //!< Time to live for packets in the queue
+  DropPolicy m_dropPolicy;                  //!< Drop behavior of queue
+
+  NS_LOG_TEMPLATE_DECLARE;                  //!< redefinition of the log component
+};
+
+} //namespace ns3
+
+#endif /* WIFI_MAC_QUEUE_H */
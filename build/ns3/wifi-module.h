@@ -0,0 +1,136 @@
+
+#ifdef NS3_MODULE_COMPILATION
+# error "Do not include ns3 module aggregator headers from other modules; these are meant only for end user scripts."
+#endif
+
+#ifndef NS3_MODULE_WIFI
+    
+
+// Module headers:
+#include "aarf-wifi-manager.h"
+#include "aarfcd-wifi-manager.h"
+#include "adhoc-wifi-mac.h"
+#include "ampdu-subframe-header.h"
+#include "ampdu-tag.h"
+#include "amrr-wifi-manager.h"
+#include "amsdu-subframe-header.h"
+#include "ap-wifi-mac.h"
+#include "aparf-wifi-manager.h"
+#include "arf-wifi-manager.h"
+#include "athstats-helper.h"
+#include "block-ack-agreement.h"
+#include "block-ack-cache.h"
+#include "block-ack-manager.h"
+#include "capability-information.h"
+#include "cara-wifi-manager.h"
+#include "codebook-analytical.h"
+#include "codebook-numerical.h"
+#include "codebook-parametric.h"
+#include "codebook.h"
+#include "common-header.h"
+#include "constant-rate-wifi-manager.h"
+#include "ctrl-headers.h"
+#include "dca-txop.h"
+#include "dcf-manager.h"
+#include "dcf-state.h"
+#include "dmg-abft-contention.h"
+#include "dmg-adhoc-wifi-mac.h"
+#include "dmg-ap-wifi-mac.h"
+#include "dmg-ati-dca.h"
+#include "dmg-beacon-dca.h"
+#include "dmg-capabilities.h"
+#include "dmg-error-model.h"
+#include "dmg-information-elements.h"
+#include "dmg-remote-signal-header.h"
+#include "dmg-sls-dca.h"
+#include "dmg-snr-wifi-manager.h"
+#include "dmg-sta-wifi-mac.h"
+#include "dmg-station-table.h"
+#include "dmg-wifi-channel.h"
+#include "dmg-wifi-helper.h"
+#include "dmg-wifi-mac-helper.h"
+#include "dmg-wifi-mac.h"
+#include "dmg-wifi-phy.h"
+#include "dmg-wifi-spectrum-phy-interface.h"
+#include "dsss-error-rate-model.h"
+#include "dsss-parameter-set.h"
+#include "edca-parameter-set.h"
+#include "edca-txop-n.h"
+#include "erp-information.h"
+#include "error-rate-model.h"
+#include "ext-headers.h"
+#include "extended-capabilities.h"
+#include "fields-headers.h"
+#include "frame-capture-model.h"
+#include "he-capabilities.h"
+#include "he-operation.h"
+#include "ht-capabilities.h"
+#include "ht-operation.h"
+#include "ideal-wifi-manager.h"
+#include "interference-helper.h"
+#include "mac-low-transmission-parameters.h"
+#include "mac-low.h"
+#include "mac-rx-middle.h"
+#include "mac-tx-middle.h"
+#include "mgt-headers.h"
+#include "minstrel-ht-wifi-manager.h"
+#include "minstrel-wifi-manager.h"
+#include "mpdu-aggregator.h"
+#include "msdu-aggregator.h"
+#include "multi-band-net-device.h"
+#include "multi-band-wifi-helper.h"
+#include "nist-error-rate-model.h"
+#include "onoe-wifi-manager.h"
+#include "originator-block-ack-agreement.h"
+#include "parf-wifi-manager.h"
+#include "qd-propagation-delay.h"
+#include "qd-propagation-loss.h"
+#include "qos-blocked-destinations.h"
+#include "qos-utils.h"
+#include "regular-wifi-mac.h"
+#include "rraa-wifi-manager.h"
+#include "rrpaa-wifi-manager.h"
+#include "sensitivity-lut.h"
+#include "sensitivity-model-60-ghz.h"
+#include "simple-frame-capture-model.h"
+#include "snr-tag.h"
+#include "spectrum-dmg-wifi-phy.h"
+#include "spectrum-wifi-helper.h"
+#include "spectrum-wifi-phy.h"
+#include "ssid.h"
+#include "sta-wifi-mac.h"
+#include "status-code.h"
+#include "supported-rates.h"
+#include "vht-capabilities.h"
+#include "vht-operation.h"
+#include "wifi-helper.h"
+#include "wifi-information-element-vector.h"
+#include "wifi-information-element.h"
+#include "wifi-mac-header.h"
+#include "wifi-mac-helper.h"
+#include "wifi-mac-queue-item.h"
+#include "wifi-mac-queue.h"
+#include "wifi-mac-trailer.h"
+#include "wifi-mac.h"
+#include "wifi-mode.h"
+#include "wifi-net-device.h"
+#include "wifi-phy-listener.h"
+#include "wifi-phy-standard.h"
+#include "wifi-phy-state-helper.h"
+#include "wifi-phy-state.h"
+#include "wifi-phy-tag.h"
+#include "wifi-phy.h"
+#include "wifi-preamble.h"
+#include "wifi-radio-energy-model-helper.h"
+#include "wifi-radio-energy-model.h"
+#include "wifi-remote-station-manager.h"
+#include "wifi-spectrum-phy-interface.h"
+#include "wifi-spectrum-signal-parameters.h"
+#include "wifi-tx-current-model.h"
+#include "wifi-tx-vector.h"
+#include "wifi-utils.h"
+#include "yans-error-rate-model.h"
+#include "yans-wifi-channel.h"
+#include "yans-wifi-helper.h"
+#include "yans-wifi-phy.h"
+#endif
@@ -34,10 +34,16 @@
  *
  *
  * Simulation Description:
+ * The S-PCP/S-AP starts beaconing in the first Beacon SP, while each of the remaining DMG PCP/APs monitors the
+ * channel and joins the cluster in an empty Beacon SP. When spatial reuse is enabled, a PCP/AP that does not find
+ * an empty Beacon SP shares the occupied Beacon SP with the weakest measured interference, provided it is below
+ * the spatial reuse threshold. Reduce the number of Beacon SPs (clusterMaxMem) to evaluate this case.
  *
  * Running Simulation:
  * To use this script simply type the following run command:
  * ./waf --run "evaluate_decentralized_clustering"
+ * To let the four DMG PCP/APs share two Beacon SPs:
+ * ./waf --run "evaluate_decentralized_clustering --clusterMaxMem=2 --spatialReuse=1 --spatialReuseThreshold=60"
  *
  * Simulation Output:
  * The simulation generates four PCAP files for each DMG AP and DMG STA in the scenario.
@@ -70,6 +76,9 @@ uint32_t maxPackets = 0;                      /* Maximum Number of Packets */
 uint32_t msduAggregationSize = 7935;          /* The maximum aggregation size for A-MSDU in Bytes. */
 uint32_t mpduAggregationSize = 262143;        /* The maximum aggregation size for A-MPDU in Bytes. */
 double simulationTime = 10;                   /* Simulation time in seconds. */
+uint32_t clusterMaxMem = 4;                   /* The number of Beacon SPs in the cluster. */
+bool spatialReuse = false;                    /* Allow PCP/APs to share Beacon SPs. */
+double spatialReuseThreshold = 10;            /* The SNR in dB below which a cluster member is non-interfering. */
 
 /**  Applications **/
 CommunicationPairList communicationPairList;    /* List of communicating devices. */
@@ -139,6 +148,12 @@ CreateAccessPoint (Ptr<Node> apNode, Ssid ssid,
   return (StaticCast<WifiNetDevice> (apDevice.Get (0)));
 }
 
+void SharedBeaconSP (Ptr<DmgWifiMac> apWifiMac, Mac48Address address, uint8_t beaconSPIndex, double snr)
+{
+  std::cout << "DMG PCP/AP " << apWifiMac->GetAddress () << " shares BeaconSP=" << static_cast<uint16_t> (beaconSPIndex)
+            << " of ClusterID=" << address << ", measured interference SNR=" << snr << " dB" << std::endl;
+}
+
 void
 SLSCompleted (Ptr<DmgWifiMac> wifiMac, Mac48Address address, ChannelAccessPeriod accessPeriod,
               BeamformingDirection beamformingDirection, bool isInitiatorTxss, bool isResponderTxss,
@@ -243,6 +258,9 @@ main (int argc, char *argv[])
   cmd.AddValue ("simulationTime", "Simulation time in seconds", simulationTime);
   cmd.AddValue ("snapShotLength", "The maximum PCAP Snapshot Length", snapShotLength);
   cmd.AddValue ("pcap", "Enable PCAP Tracing", pcapTracing);
+  cmd.AddValue ("clusterMaxMem", "The number of Beacon SPs in the cluster (2 or 4)", clusterMaxMem);
+  cmd.AddValue ("spatialReuse", "Allow PCP/APs to share Beacon SPs with non-interfering cluster members", spatialReuse);
+  cmd.AddValue ("spatialReuseThreshold", "The SNR in dB below which a cluster member is considered non-interfering", spatialReuseThreshold);
   cmd.Parse (argc, argv);
 
   /* Global params: no fragmentation, no RTS/CTS, fixed rate for all packets */
@@ -250,6 +268,10 @@ main (int argc, char *argv[])
   Config::SetDefault ("ns3::WifiRemoteStationManager::RtsCtsThreshold", StringValue ("999999"));
   Config::SetDefault ("ns3::QueueBase::MaxPackets", UintegerValue (queueSize));
 
+  /* Spatial reuse of the Beacon SPs */
+  Config::SetDefault ("ns3::DmgApWifiMac::EnableSpatialReuse", BooleanValue (spatialReuse));
+  Config::SetDefault ("ns3::DmgApWifiMac::SpatialReuseThreshold", DoubleValue (spatialReuseThreshold));
+
   /*** Configure TCP Options ***/
   /* Select TCP variant */
   std::map<std::string, std::string>::const_iterator iter = tcpVariants.find (tcpVariant);
@@ -331,7 +353,7 @@ main (int argc, char *argv[])
                    "SSSlotsPerABFT", UintegerValue (8), "SSFramesPerSlot", UintegerValue (16),
                    "BeaconInterval", TimeValue (MicroSeconds (102400)),
                    "EnableDecentralizedClustering", BooleanValue (true),
-                   "ClusterMaxMem", UintegerValue (4),
+                   "ClusterMaxMem", UintegerValue (clusterMaxMem),
                    "BeaconSPDuration", UintegerValue (100),
                    "ClusterRole", EnumValue (SYNC_PCP_AP));
 
@@ -417,6 +439,7 @@ main (int argc, char *argv[])
       wifiNetDevice = StaticCast<WifiNetDevice> (apDevices.Get (i));
       dmgWifiMac = StaticCast<DmgWifiMac> (wifiNetDevice->GetMac ());
       dmgWifiMac->TraceConnectWithoutContext ("JoinedCluster", MakeBoundCallback (&JoinedCluster, dmgWifiMac));
+      dmgWifiMac->TraceConnectWithoutContext ("SharedBeaconSP", MakeBoundCallback (&SharedBeaconSP, dmgWifiMac));
       dmgWifiMac->TraceConnectWithoutContext ("SLSCompleted", MakeBoundCallback (&SLSCompleted, dmgWifiMac));
     }
   wifiNetDevice = StaticCast<WifiNetDevice> (syncApDevice.Get (0));
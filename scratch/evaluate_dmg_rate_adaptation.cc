@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2015-2019 IMDEA Networks Institute
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+#include "ns3/applications-module.h"
+#include "ns3/core-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/network-module.h"
+#include "ns3/wifi-module.h"
+#include "common-functions.h"
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * Simulation Objective:
+ * This script compares the SNR-driven DMG rate adaptation algorithm (DmgSnrWifiManager) against a constant
+ * rate algorithm (ConstantRateWifiManager) using the custom SNR to BER lookup tables of the DMG error model.
+ *
+ * Network Topology:
+ * The scenario consists of a signle DMG STA and a single DMG PCP/AP.
+ *
+ *          DMG PCP/AP (0,0)                       DMG STA (+d,0)
+ *
+ * Simulation Description:
+ * The DMG STA generates uplink UDP traffic towards the DMG PCP/AP. For each distance in the list, the scenario
+ * is simulated once with each remote station manager. The SNR-driven manager seeds its MCS from the SNR measured
+ * during the beamforming training and then follows the data SNR reported in the ACK/Block ACK frames.
+ *
+ * Running Simulation:
+ * ./waf --run "evaluate_dmg_rate_adaptation --distances=1,10,20,30 --simulationTime=3"
+ *
+ * Simulation Output:
+ * A table with the application layer throughput and the MCS used by each remote station manager at each distance.
+ */
+
+NS_LOG_COMPONENT_DEFINE ("EvaluateDmgRateAdaptation");
+
+using namespace ns3;
+using namespace std;
+
+/* Statistics */
+uint64_t macTxDataFailed = 0;
+uint64_t lastRate = 0;
+
+void
+MacTxDataFailed (Mac48Address)
+{
+  macTxDataFailed++;
+}
+
+void
+RateChanged (uint64_t oldRate, uint64_t newRate)
+{
+  lastRate = newRate;
+}
+
+/**
+ * Simulate the scenario once.
+ * \param manager The type of the remote station manager of the DMG STA.
+ * \param distance The distance between the DMG STA and the DMG PCP/AP.
+ * \return The application layer throughput in Mbps.
+ */
+double
+RunScenario (string manager, string phyMode, double distance, string dataRate, uint32_t payloadSize,
+             uint32_t mpduAggregationSize, double simulationTime)
+{
+  macTxDataFailed = 0;
+  lastRate = 0;
+
+  /**** DmgWifiHelper is a meta-helper: it helps creates helpers ****/
+  DmgWifiHelper wifi;
+
+  /**** Set up Channel ****/
+  DmgWifiChannelHelper wifiChannel ;
+  /* Simple propagation delay model */
+  wifiChannel.SetPropagationDelay ("ns3::ConstantSpeedPropagationDelayModel");
+  /* Friis model with standard-specific wavelength */
+  wifiChannel.AddPropagationLoss ("ns3::FriisPropagationLossModel", "Frequency", DoubleValue (60.48e9));
+
+  /**** Setup physical layer ****/
+  DmgWifiPhyHelper wifiPhy = DmgWifiPhyHelper::Default ();
+  /* Nodes will be added to the channel we set up earlier */
+  wifiPhy.SetChannel (wifiChannel.Create ());
+  /* All nodes transmit at 10 dBm == 10 mW, no adaptation */
+  wifiPhy.Set ("TxPowerStart", DoubleValue (10.0));
+  wifiPhy.Set ("TxPowerEnd", DoubleValue (10.0));
+  wifiPhy.Set ("TxPowerLevels", UintegerValue (1));
+  /* Set operating channel */
+  wifiPhy.Set ("ChannelNumber", UintegerValue (2));
+  /* Set error model */
+  wifiPhy.SetErrorRateModel ("ns3::DmgErrorModel",
+                             "FileName", StringValue ("DmgFiles/ErrorModel/LookupTable_1458.txt"));
+  /* Sensitivity model includes implementation loss and noise figure */
+  wifiPhy.Set ("CcaMode1Threshold", DoubleValue (-79));
+  wifiPhy.Set ("EnergyDetectionThreshold", DoubleValue (-79 + 3));
+
+  /* Make two nodes and set them up with the PHY and the MAC */
+  NodeContainer wifiNodes;
+  wifiNodes.Create (2);
+  Ptr<Node> apWifiNode = wifiNodes.Get (0);
+  Ptr<Node> staWifiNode = wifiNodes.Get (1);
+
+  /* Add a DMG upper mac */
+  DmgWifiMacHelper wifiMac = DmgWifiMacHelper::Default ();
+
+  Ssid ssid = Ssid ("RateAdaptation");
+  wifiMac.SetType ("ns3::DmgApWifiMac",
+                   "Ssid", SsidValue(ssid),
+                   "BE_MaxAmpduSize", UintegerValue (mpduAggregationSize),
+                   "BE_MaxAmsduSize", UintegerValue (0),
+                   "SSSlotsPerABFT", UintegerValue (8), "SSFramesPerSlot", UintegerValue (8),
+                   "BeaconInterval", TimeValue (MicroSeconds (102400)),
+                   "ATIPresent", BooleanValue (false));
+
+  /* Set Analytical Codebook for the DMG Devices */
+  wifi.SetCodebook ("ns3::CodebookAnalytical",
+                    "CodebookType", EnumValue (SIMPLE_CODEBOOK),
+                    "Antennas", UintegerValue (1),
+                    "Sectors", UintegerValue (8));
+
+  /* The DMG PCP/AP only sends control and management frames, so it keeps the constant rate algorithm */
+  wifi.SetRemoteStationManager ("ns3::ConstantRateWifiManager", "DataMode", StringValue (phyMode));
+  NetDeviceContainer apDevice;
+  apDevice = wifi.Install (wifiPhy, wifiMac, apWifiNode);
+
+  wifiMac.SetType ("ns3::DmgStaWifiMac",
+                   "Ssid", SsidValue (ssid), "ActiveProbing", BooleanValue (false),
+                   "BE_MaxAmpduSize", UintegerValue (mpduAggregationSize),
+                   "BE_MaxAmsduSize", UintegerValue (0));
+
+  if (manager == "ns3::ConstantRateWifiManager")
+    {
+      wifi.SetRemoteStationManager (manager, "DataMode", StringValue (phyMode));
+    }
+  else
+    {
+      wifi.SetRemoteStationManager (manager);
+    }
+  NetDeviceContainer staDevice;
+  staDevice = wifi.Install (wifiPhy, wifiMac, staWifiNode);
+
+  /* Setting mobility model */
+  MobilityHelper mobility;
+  Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator> ();
+  positionAlloc->Add (Vector (0.0, 0.0, 0.0));        /* DMG PCP/AP */
+  positionAlloc->Add (Vector (distance, 0.0, 0.0));   /* DMG STA */
+
+  mobility.SetPositionAllocator (positionAlloc);
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (wifiNodes);
+
+  /* Internet stack*/
+  InternetStackHelper stack;
+  stack.Install (wifiNodes);
+
+  Ipv4AddressHelper address;
+  address.SetBase ("10.0.0.0", "255.255.255.0");
+  Ipv4InterfaceContainer apInterface;
+  apInterface = address.Assign (apDevice);
+  Ipv4InterfaceContainer staInterface;
+  staInterface = address.Assign (staDevice);
+
+  /* Populate routing table */
+  Ipv4GlobalRoutingHelper::PopulateRoutingTables ();
+
+  /* We do not want any ARP packets */
+  PopulateArpCache ();
+
+  /* Install Simple UDP Server on the DMG AP */
+  PacketSinkHelper sinkHelper ("ns3::UdpSocketFactory", InetSocketAddress (Ipv4Address::GetAny (), 9999));
+  ApplicationContainer sinkApp = sinkHelper.Install (apWifiNode);
+  Ptr<PacketSink> packetSink = StaticCast<PacketSink> (sinkApp.Get (0));
+  sinkApp.Start (Seconds (0.0));
+
+  /* Install UDP Transmitter on the DMG STA */
+  ApplicationContainer srcApp;
+  OnOffHelper src ("ns3::UdpSocketFactory", InetSocketAddress (apInterface.GetAddress (0), 9999));
+  src.SetAttribute ("MaxBytes", UintegerValue (0));
+  src.SetAttribute ("PacketSize", UintegerValue (payloadSize));
+  src.SetAttribute ("OnTime", StringValue ("ns3::ConstantRandomVariable[Constant=1e6]"));
+  src.SetAttribute ("OffTime", StringValue ("ns3::ConstantRandomVariable[Constant=0]"));
+  src.SetAttribute ("DataRate", DataRateValue (DataRate (dataRate)));
+  srcApp = src.Install (staWifiNode);
+  srcApp.Start (Seconds (1.0));
+  srcApp.Stop (Seconds (simulationTime));
+
+  /* Connect Traces */
+  Ptr<WifiNetDevice> staWifiNetDevice = StaticCast<WifiNetDevice> (staDevice.Get (0));
+  Ptr<WifiRemoteStationManager> staRemoteStationManager = staWifiNetDevice->GetRemoteStationManager ();
+  staRemoteStationManager->TraceConnectWithoutContext ("MacTxDataFailed", MakeCallback (&MacTxDataFailed));
+  staRemoteStationManager->TraceConnectWithoutContext ("Rate", MakeCallback (&RateChanged));
+
+  Simulator::Stop (Seconds (simulationTime + 0.101));
+  Simulator::Run ();
+  double throughput = packetSink->GetTotalRx () * 8.0 / ((simulationTime - 1) * 1e6);
+  Simulator::Destroy ();
+  return throughput;
+}
+
+int
+main(int argc, char *argv[])
+{
+  uint32_t payloadSize = 1472;                  /* Application payload size in bytes. */
+  string dataRate = "1Gbps";                    /* Application data rate. */
+  uint32_t mpduAggregationSize = 262143;        /* The maximum aggregation size for A-MSPU in Bytes. */
+  uint32_t queueSize = 1000;                    /* Wifi MAC Queue Size. */
+  string phyMode = "DMG_MCS12";                 /* The MCS used by the constant rate algorithm. */
+  string distances = "1,10,20,30,40";           /* The distances between devices. */
+  double simulationTime = 2;                    /* Simulation time in seconds. */
+
+  /* Command line argument parser setup. */
+  CommandLine cmd;
+  cmd.AddValue ("payloadSize", "Application payload size in bytes", payloadSize);
+  cmd.AddValue ("dataRate", "Application data rate", dataRate);
+  cmd.AddValue ("mpduAggregation", "The maximum aggregation size for A-MPDU in Bytes", mpduAggregationSize);
+  cmd.AddValue ("queueSize", "The maximum size of the Wifi MAC Queue", queueSize);
+  cmd.AddValue ("phyMode", "802.11ad PHY Mode used by the constant rate algorithm", phyMode);
+  cmd.AddValue ("distances", "Comma separated list of distances between devices", distances);
+  cmd.AddValue ("simulationTime", "Simulation time in seconds", simulationTime);
+  cmd.Parse (argc, argv);
+
+  /* Global params: no fragmentation, no RTS/CTS */
+  Config::SetDefault ("ns3::WifiRemoteStationManager::FragmentationThreshold", StringValue ("999999"));
+  Config::SetDefault ("ns3::WifiRemoteStationManager::RtsCtsThreshold", StringValue ("999999"));
+  Config::SetDefault ("ns3::QueueBase::MaxPackets", UintegerValue (queueSize));
+
+  std::vector<double> distanceList;
+  std::istringstream stream (distances);
+  std::string item;
+  while (std::getline (stream, item, ','))
+    {
+      distanceList.push_back (atof (item.c_str ()));
+    }
+
+  /* Print Output*/
+  std::cout << std::left << std::setw (14) << "Distance [m]"
+            << std::left << std::setw (24) << "Constant [Mbps]"
+            << std::left << std::setw (12) << "Failed"
+            << std::left << std::setw (24) << "SNR-driven [Mbps]"
+            << std::left << std::setw (12) << "Failed"
+            << std::left << std::setw (12) << "Rate [Mbps]" << std::endl;
+
+  for (std::vector<double>::const_iterator it = distanceList.begin (); it != distanceList.end (); it++)
+    {
+      double constantThroughput = RunScenario ("ns3::ConstantRateWifiManager", phyMode, *it, dataRate, payloadSize,
+                                               mpduAggregationSize, simulationTime);
+      uint64_t constantFailed = macTxDataFailed;
+      double snrThroughput = RunScenario ("ns3::DmgSnrWifiManager", phyMode, *it, dataRate, payloadSize,
+                                          mpduAggregationSize, simulationTime);
+      std::cout << std::left << std::setw (14) << *it
+                << std::left << std::setw (24) << constantThroughput
+                << std::left << std::setw (12) << constantFailed
+                << std::left << std::setw (24) << snrThroughput
+                << std::left << std::setw (12) << macTxDataFailed
+                << std::left << std::setw (12) << lastRate / 1e6 << std::endl;
+    }
+
+  return 0;
+}
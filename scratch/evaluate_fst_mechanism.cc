@@ -32,12 +32,20 @@
  * To generate PCAP files, type the following run command:
  * ./waf --run "evaluate_fst_mechanism --llt=10000 --dataRate=5Gbps --pcap=1"
  *
+ * To compare the fast switch path against the legacy band change, type the following run commands:
+ * ./waf --run "evaluate_fst_mechanism --dataRate=300Mbps --fastSwitch=1"
+ * ./waf --run "evaluate_fst_mechanism --dataRate=300Mbps --fastSwitch=0"
+ *
  * Simulation Output:
  * The simulation generates the following traces:
  * 1. PCAP traces for each station. The simulation generates two PCAP files for each node.
  * One PCAP file corresponds to 11ad Band and the other PCAP for 11n band.
  * In the 11ad PCAP files, you can check the setup of FSTS. In the 11n PCAP file you can
  * see the exchange of FST ACK Request/Response frames.
+ * 2. A summary of the band switch: the switch latency measured from the link interruption
+ * until the first packet is delivered in the new band, the number of packets moved to the new
+ * band, the throughput before and after the switch, and the throughput dip measured over short
+ * windows (--dipWindow) around the switch.
  */
 
 NS_LOG_COMPONENT_DEFINE ("EvaluateFstMechanism");
@@ -55,6 +63,20 @@ Ptr<PacketSink> sink;
 uint64_t lastTotalRx = 0;
 double averagethroughput = 0;
 
+/*** Band Switch Statistics ***/
+Time blockageTime;                          /* The time at which the link is interrupted. */
+Time switchTime;                            /* The time at which the STA changed the band. */
+Time firstRxAfterSwitch;                    /* The time of the first packet delivered in the new band. */
+bool switched = false;
+bool receivedAfterSwitch = false;
+uint32_t staMovedPackets = 0;
+uint32_t apMovedPackets = 0;
+uint64_t txPackets = 0;
+uint64_t rxPackets = 0;
+Time dipWindow;                             /* The window used to sample the throughput dip. */
+uint64_t lastWindowRx = 0;
+std::vector<std::pair<double, double> > windowThroughput;   /* (Time [s], Throughput [Mbps]) */
+
 void
 CalculateThroughput ()
 {
@@ -66,6 +88,122 @@ CalculateThroughput ()
   Simulator::Schedule (MilliSeconds (100), &CalculateThroughput);
 }
 
+void
+SampleWindowThroughput ()
+{
+  double cur = (sink->GetTotalRx () - lastWindowRx) * (double) 8 / (dipWindow.GetSeconds () * 1e6);
+  windowThroughput.push_back (std::make_pair (Simulator::Now ().GetSeconds (), cur));
+  lastWindowRx = sink->GetTotalRx ();
+  Simulator::Schedule (dipWindow, &SampleWindowThroughput);
+}
+
+void
+PacketTransmitted (Ptr<const Packet> packet)
+{
+  txPackets++;
+}
+
+void
+PacketReceived (Ptr<const Packet> packet, const Address &from)
+{
+  rxPackets++;
+  if (switched && !receivedAfterSwitch)
+    {
+      receivedAfterSwitch = true;
+      firstRxAfterSwitch = Simulator::Now ();
+    }
+}
+
+void
+BandChanged (bool isStation, WifiPhyStandard oldStandard, WifiPhyStandard newStandard, Mac48Address address, uint32_t packets)
+{
+  std::cout << (isStation ? "STA" : "AP") << " changed band at " << Simulator::Now ().GetSeconds ()
+            << " s, moved " << packets << " queued packets" << std::endl;
+  if (isStation)
+    {
+      switched = true;
+      switchTime = Simulator::Now ();
+      staMovedPackets = packets;
+    }
+  else
+    {
+      apMovedPackets = packets;
+    }
+}
+
+/**
+ * Average the sampled throughput over an interval.
+ * \param start The start of the interval in seconds.
+ * \param end The end of the interval in seconds.
+ * \return The average throughput in Mbps.
+ */
+double
+AverageWindowThroughput (double start, double end)
+{
+  double sum = 0;
+  uint32_t samples = 0;
+  for (std::vector<std::pair<double, double> >::const_iterator it = windowThroughput.begin ();
+       it != windowThroughput.end (); it++)
+    {
+      if ((it->first > start) && (it->first <= end))
+        {
+          sum += it->second;
+          samples++;
+        }
+    }
+  return (samples == 0) ? 0 : sum / samples;
+}
+
+void
+PrintSwitchSummary (double simulationTime)
+{
+  double blockage = blockageTime.GetSeconds ();
+  double before = AverageWindowThroughput (1.1, blockage);
+  std::cout << std::endl << "Band Switch Summary:" << std::endl;
+  std::cout << "  Throughput before blockage = " << before << " Mbps" << std::endl;
+  std::cout << "  Packets sent = " << txPackets << ", received = " << rxPackets << std::endl;
+  if (!switched)
+    {
+      std::cout << "  No band switch took place" << std::endl;
+      return;
+    }
+  std::cout << "  Band switch delay = " << (switchTime - blockageTime).GetMicroSeconds () / 1e3 << " ms" << std::endl;
+  std::cout << "  Packets moved to the new band = " << staMovedPackets << " (STA), " << apMovedPackets << " (AP)" << std::endl;
+  if (!receivedAfterSwitch)
+    {
+      std::cout << "  No packet received in the new band" << std::endl;
+      return;
+    }
+  double after = AverageWindowThroughput (firstRxAfterSwitch.GetSeconds () + 0.1, simulationTime);
+  std::cout << "  Switch latency = " << (firstRxAfterSwitch - blockageTime).GetMicroSeconds () / 1e3 << " ms"
+            << " (first packet " << (firstRxAfterSwitch - switchTime).GetMicroSeconds () / 1e3
+            << " ms after the band switch)" << std::endl;
+  std::cout << "  Throughput after switch = " << after << " Mbps" << std::endl;
+  /* The dip lasts until the window throughput reaches 90% of the throughput in the new band */
+  double minimum = before;
+  double recovery = -1;
+  for (std::vector<std::pair<double, double> >::const_iterator it = windowThroughput.begin ();
+       it != windowThroughput.end (); it++)
+    {
+      if (it->first <= blockage)
+        {
+          continue;
+        }
+      minimum = std::min (minimum, it->second);
+      if (it->first > firstRxAfterSwitch.GetSeconds () && it->second >= 0.9 * after)
+        {
+          recovery = it->first - blockage;
+          break;
+        }
+    }
+  std::cout << "  Throughput dip = " << minimum << " Mbps (minimum over " << dipWindow.GetMicroSeconds () / 1e3
+            << " ms windows)" << std::endl;
+  if (recovery >= 0)
+    {
+      std::cout << "  Recovery time = " << recovery * 1e3 << " ms" << std::endl;
+    }
+}
+
 /**
  * Insert Blockage
  * \return The actual value of the blockage we introduce in the simulator.
@@ -85,6 +223,7 @@ void
 InsertBlockage (Ptr<DmgWifiChannel> channel, Ptr<WifiPhy> srcWifiPhy, Ptr<WifiPhy> dstWifiPhy)
 {
   std::cout << "Blockage Inserted at " << Simulator::Now () << std::endl;
+  blockageTime = Simulator::Now ();
   channel->AddBlockage (&DoInsertBlockage, srcWifiPhy, dstWifiPhy);
 }
 
@@ -99,6 +238,9 @@ main(int argc, char *argv[])
   uint32_t llt = 100;                           /* Link Loss Timeout. */
   double simulationTime = 10;                   /* Simulation time in seconds. */
   bool pcapTracing = false;                     /* PCAP Tracing is enabled or not. */
+  bool fastSwitch = true;                       /* Hand over the whole session on band change. */
+  double blockage = 3;                          /* The time at which the link is interrupted in seconds. */
+  uint32_t window = 10;                         /* The window used to sample the throughput dip in ms. */
 
   /* Command line argument parser setup. */
   CommandLine cmd;
@@ -111,12 +253,17 @@ main(int argc, char *argv[])
   cmd.AddValue ("nPhyMode", "802.11n PHY Mode", nPhyMode);
   cmd.AddValue ("simulationTime", "Simulation time in seconds", simulationTime);
   cmd.AddValue ("pcap", "Enable PCAP Tracing", pcapTracing);
+  cmd.AddValue ("fastSwitch", "Hand over the queued packets and the BlockAck agreements on band change", fastSwitch);
+  cmd.AddValue ("blockageTime", "The time at which the link is interrupted in seconds", blockage);
+  cmd.AddValue ("dipWindow", "The window used to sample the throughput dip in ms", window);
   cmd.Parse (argc, argv);
+  dipWindow = MilliSeconds (window);
 
   /* Global params: no fragmentation, no RTS/CTS, fixed rate for all packets */
   Config::SetDefault ("ns3::WifiRemoteStationManager::FragmentationThreshold", StringValue ("999999"));
   Config::SetDefault ("ns3::WifiRemoteStationManager::RtsCtsThreshold", StringValue ("999999"));
   Config::SetDefault ("ns3::QueueBase::MaxPackets", UintegerValue (queueSize));
+  Config::SetDefault ("ns3::MultiBandNetDevice::FastSwitch", BooleanValue (fastSwitch));
 
   /**** Allocate 802.11ad Wifi MAC ****/
   /* Add a DMG upper mac */
@@ -155,6 +302,7 @@ main(int argc, char *argv[])
   adWifiStruct.MacHelper = &adWifiMac;
   adWifiStruct.PhyHelper = &adWifiPhy;
   adWifiStruct.RemoteStationManagerFactory = adremoteStationManager;
+  adWifiStruct.CodeBookFactory = adCodebook;
   adWifiStruct.Standard = WIFI_PHY_STANDARD_80211ad;
   adWifiStruct.Operational = true;
 
@@ -289,6 +437,9 @@ main(int argc, char *argv[])
   srcApp = src.Install (staWifiNode);
   srcApp.Start (Seconds (1.0));
   Simulator::Schedule (Seconds (1.1), &CalculateThroughput);
+  Simulator::Schedule (Seconds (1.1), &SampleWindowThroughput);
+  sink->TraceConnectWithoutContext ("Rx", MakeCallback (&PacketReceived));
+  srcApp.Get (0)->TraceConnectWithoutContext ("Tx", MakeCallback (&PacketTransmitted));
 
   /* Enable Traces */
   if (pcapTracing)
@@ -339,12 +490,17 @@ main(int argc, char *argv[])
                        Mac48Address::ConvertFrom (apMultibandDevice->GetAddress ()));
 
   /* Schedule for link Interruption */
-  Simulator::Schedule (Seconds (3), &InsertBlockage, adChannel, srcWifiPhy, dstWifiPhy);
+  Simulator::Schedule (Seconds (blockage), &InsertBlockage, adChannel, srcWifiPhy, dstWifiPhy);
+
+  staMultibandDevice->TraceConnectWithoutContext ("BandChanged", MakeBoundCallback (&BandChanged, true));
+  apMultibandDevice->TraceConnectWithoutContext ("BandChanged", MakeBoundCallback (&BandChanged, false));
 
   /* Start Simulation */
   Simulator::Stop (Seconds (simulationTime));
   Simulator::Run ();
   Simulator::Destroy ();
 
+  PrintSwitchSummary (simulationTime);
+
   return 0;
 }
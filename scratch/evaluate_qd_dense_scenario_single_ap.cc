@@ -304,6 +304,8 @@ main (int argc, char *argv[])
   bool verbose = false;                           /* Print Logging Information. */
   bool pcapTracing = false;                       /* PCAP Tracing is enabled or not. */
   uint16_t numSTAs = 10;                          /* The number of DMG STAs. */
+  bool logicalAbft = false;                       /* Resolve A-BFT contention logically. */
+  bool bhiAbstraction = false;                    /* Abstract the BHI instead of simulating DMG Beacons and SSW frames. */
   std::map<std::string, std::string> tcpVariants; /* List of the TCP Variants */
   std::string qdChannelFolder = "DenseScenario"; /* The name of the folder containing the QD-Channel files. */
 
@@ -339,6 +341,8 @@ main (int argc, char *argv[])
   cmd.AddValue ("snapShotLength", "The maximum PCAP Snapshot Length", snapShotLength);
   cmd.AddValue ("qdChannelFolder", "The name of the folder containing the QD-Channel files", qdChannelFolder);
   cmd.AddValue ("numSTAs", "The number of DMG STA", numSTAs);
+  cmd.AddValue ("logicalAbft", "Resolve the A-BFT slot contention logically and simulate only non-collided slots", logicalAbft);
+  cmd.AddValue ("bhiAbstraction", "Abstract the BHI and derive the A-BFT beamforming from the geometry", bhiAbstraction);
   cmd.AddValue ("pcap", "Enable PCAP Tracing", pcapTracing);
   cmd.AddValue ("csv", "Enable CSV output instead of plain text. This mode will suppress all the messages related statistics and events.", csv);
   cmd.Parse (argc, argv);
@@ -421,7 +425,8 @@ main (int argc, char *argv[])
                          "BE_MaxAmsduSize", UintegerValue (msduAggregationSize),
                          "SSSlotsPerABFT", UintegerValue (8), "SSFramesPerSlot", UintegerValue (13),
                          "BeaconInterval", TimeValue (MicroSeconds (102400)),
-                         "ATIPresent", BooleanValue (false));
+                         "ATIPresent", BooleanValue (false),
+                         "BhiAbstraction", BooleanValue (bhiAbstraction));
 
   /* Set Parametric Codebook for the DMG AP */
   wifi.SetCodebook ("ns3::CodebookParametric",
@@ -431,10 +436,16 @@ main (int argc, char *argv[])
   NetDeviceContainer apDevice;
   apDevice = wifi.Install (spectrumWifiPhy, wifiMacHelper, apWifiNode);
 
+  Ptr<DmgAbftContention> abftContention;
+  if (logicalAbft)
+    {
+      abftContention = CreateObject<DmgAbftContention> ();
+    }
   wifiMacHelper.SetType ("ns3::DmgStaWifiMac",
                          "BE_MaxAmpduSize", UintegerValue (mpduAggregationSize),
                          "BE_MaxAmsduSize", UintegerValue (msduAggregationSize),
-                         "Ssid", SsidValue (ssid), "ActiveProbing", BooleanValue (false));
+                         "Ssid", SsidValue (ssid), "ActiveProbing", BooleanValue (false),
+                         "AbftContention", PointerValue (abftContention));
 
   /* Set Parametric Codebook for the DMG STA */
   wifi.SetCodebook ("ns3::CodebookParametric",
@@ -569,6 +580,13 @@ main (int argc, char *argv[])
 
   Simulator::Stop (Seconds (simulationTime + 0.101));
   Simulator::Run ();
+
+  if (!csv && logicalAbft)
+    {
+      std::cout << "A-BFT Slots: Successful=" << abftContention->GetSuccessfulSlots ()
+                << ", Collided=" << abftContention->GetCollidedSlots () << std::endl;
+    }
+
   Simulator::Destroy ();
 
   if (!csv)
@@ -0,0 +1,66 @@
+#include "ns3/applications-module.h"
+#include "ns3/core-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/network-module.h"
+#include "ns3/wifi-module.h"
+#include "common-functions.h"
+#include <chrono>
+using namespace ns3;
+static uint32_t assoc = 0; static double sumT = 0;
+void Assoc (Mac48Address a, uint16_t aid) { assoc++; sumT += Simulator::Now ().GetSeconds (); }
+int main (int argc, char *argv[])
+{
+  uint32_t n = 20; bool logical = false; bool bhi = false; double simTime = 2; uint32_t seed = 1;
+  CommandLine cmd;
+  cmd.AddValue ("n", "n", n); cmd.AddValue ("logical", "l", logical); cmd.AddValue ("t", "t", simTime); cmd.AddValue ("seed", "s", seed); cmd.AddValue ("bhi", "b", bhi);
+  cmd.Parse (argc, argv);
+  RngSeedManager::SetRun (seed);
+  DmgWifiHelper wifi;
+  DmgWifiChannelHelper wifiChannel;
+  wifiChannel.SetPropagationDelay ("ns3::ConstantSpeedPropagationDelayModel");
+  wifiChannel.AddPropagationLoss ("ns3::FriisPropagationLossModel", "Frequency", DoubleValue (60.48e9));
+  DmgWifiPhyHelper wifiPhy = DmgWifiPhyHelper::Default ();
+  wifiPhy.SetChannel (wifiChannel.Create ());
+  wifiPhy.Set ("TxPowerStart", DoubleValue (10.0)); wifiPhy.Set ("TxPowerEnd", DoubleValue (10.0)); wifiPhy.Set ("TxPowerLevels", UintegerValue (1));
+  wifiPhy.Set ("ChannelNumber", UintegerValue (2));
+  wifiPhy.Set ("CcaMode1Threshold", DoubleValue (-79)); wifiPhy.Set ("EnergyDetectionThreshold", DoubleValue (-79 + 3));
+  wifi.SetRemoteStationManager ("ns3::ConstantRateWifiManager", "ControlMode", StringValue ("DMG_MCS12"), "DataMode", StringValue ("DMG_MCS12"));
+  NodeContainer ap; ap.Create (1); NodeContainer stas; stas.Create (n);
+  DmgWifiMacHelper wifiMac = DmgWifiMacHelper::Default ();
+  Ssid ssid = Ssid ("S");
+  wifiMac.SetType ("ns3::DmgApWifiMac", "Ssid", SsidValue (ssid), "BeaconInterval", TimeValue (MicroSeconds (102400)),
+                   "SSSlotsPerABFT", UintegerValue (8), "SSFramesPerSlot", UintegerValue (8), "BhiAbstraction", BooleanValue (bhi));
+  wifi.SetCodebook ("ns3::CodebookAnalytical", "CodebookType", EnumValue (SIMPLE_CODEBOOK), "Antennas", UintegerValue (1), "Sectors", UintegerValue (8));
+  NetDeviceContainer apDev = wifi.Install (wifiPhy, wifiMac, ap);
+  Ptr<DmgAbftContention> c; if (logical) c = CreateObject<DmgAbftContention> ();
+  wifiMac.SetType ("ns3::DmgStaWifiMac", "Ssid", SsidValue (ssid), "ActiveProbing", BooleanValue (false), "AbftContention", PointerValue (c));
+  NetDeviceContainer staDev = wifi.Install (wifiPhy, wifiMac, stas);
+  MobilityHelper mobility;
+  Ptr<ListPositionAllocator> pos = CreateObject<ListPositionAllocator> ();
+  pos->Add (Vector (0, 0, 0));
+  for (uint32_t i = 0; i < n; i++) pos->Add (Vector (2 * cos (6.28 * i / n), 2 * sin (6.28 * i / n), 0));
+  mobility.SetPositionAllocator (pos); mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (ap); mobility.Install (stas);
+  InternetStackHelper stack; stack.Install (ap); stack.Install (stas);
+  for (uint32_t i = 0; i < n; i++) StaticCast<WifiNetDevice> (staDev.Get (i))->GetMac ()->TraceConnectWithoutContext ("Assoc", MakeCallback (&Assoc));
+  Ipv4AddressHelper addr; addr.SetBase ("10.0.0.0", "255.255.255.0");
+  Ipv4InterfaceContainer apIf = addr.Assign (apDev); addr.Assign (staDev);
+  PacketSinkHelper sink ("ns3::UdpSocketFactory", InetSocketAddress (Ipv4Address::GetAny (), 9999));
+  ApplicationContainer sinks = sink.Install (ap);
+  OnOffHelper src ("ns3::UdpSocketFactory", InetSocketAddress (apIf.GetAddress (0), 9999));
+  src.SetAttribute ("OnTime", StringValue ("ns3::ConstantRandomVariable[Constant=1]"));
+  src.SetAttribute ("OffTime", StringValue ("ns3::ConstantRandomVariable[Constant=0]"));
+  src.SetAttribute ("DataRate", DataRateValue (DataRate ("10Mbps"))); src.SetAttribute ("PacketSize", UintegerValue (1400));
+  ApplicationContainer srcs = src.Install (stas); srcs.Start (Seconds (1.0));
+  PopulateArpCache ();
+  auto w0 = std::chrono::steady_clock::now ();
+  Simulator::Stop (Seconds (simTime));
+  Simulator::Run ();
+  std::cout << "assoc=" << assoc << " meanT=" << (assoc ? sumT / assoc : 0) << std::endl;
+  std::cout << "wall=" << std::chrono::duration<double> (std::chrono::steady_clock::now () - w0).count () << std::endl;
+  std::cout << "rx=" << StaticCast<PacketSink> (sinks.Get (0))->GetTotalRx () << std::endl;
+  if (c) std::cout << "succ=" << c->GetSuccessfulSlots () << " coll=" << c->GetCollidedSlots () << std::endl;
+  Simulator::Destroy ();
+  return 0;
+}
@@ -21,6 +21,8 @@
 #include "event-impl.h"
 #include "log.h"
 
+#include <new>
+
 /**
  * \file
  * \ingroup events
@@ -31,6 +33,120 @@ namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("EventImpl");
 
+namespace {
+
+/** The size granularity of the event pool, in bytes. */
+const size_t EVENT_POOL_GRANULARITY = 16;
+/** The number of size classes of the event pool. */
+const size_t EVENT_POOL_CLASSES = 16;
+/** The maximum number of free blocks kept by a thread per size class. */
+const uint32_t EVENT_POOL_MAX_BLOCKS = 4096;
+
+/** Whether the event pool is used. */
+bool g_eventPoolEnabled = true;
+
+/**
+ * \ingroup events
+ * The free lists of the event pool of a thread.
+ */
+struct EventPoolCache
+{
+  /** A free block, linked to the next free block of the same size class. */
+  struct Block
+  {
+    Block *next;  /**< The next free block. */
+  };
+
+  EventPoolCache ();
+  ~EventPoolCache ();
+
+  Block *head[EVENT_POOL_CLASSES];      /**< The free blocks of each size class. */
+  uint32_t count[EVENT_POOL_CLASSES];   /**< The number of free blocks of each size class. */
+};
+
+/** Flag set once the pool of the thread has been destroyed, at thread exit. */
+thread_local bool g_eventPoolDestroyed = false;
+/** The event pool of the thread. */
+thread_local EventPoolCache g_eventPool;
+
+EventPoolCache::EventPoolCache ()
+{
+  for (size_t i = 0; i < EVENT_POOL_CLASSES; i++)
+    {
+      head[i] = 0;
+      count[i] = 0;
+    }
+}
+
+EventPoolCache::~EventPoolCache ()
+{
+  for (size_t i = 0; i < EVENT_POOL_CLASSES; i++)
+    {
+      while (head[i] != 0)
+        {
+          Block *block = head[i];
+          head[i] = block->next;
+          ::operator delete (block);
+        }
+      count[i] = 0;
+    }
+  /* The events deleted after this point (e.g., by static destructors) bypass the pool */
+  g_eventPoolDestroyed = true;
+}
+
+} // unnamed namespace
+
+void *
+EventImpl::operator new (size_t size)
+{
+  size_t index = (size - 1) / EVENT_POOL_GRANULARITY;
+  if (index >= EVENT_POOL_CLASSES)
+    {
+      return ::operator new (size);
+    }
+  if (g_eventPoolEnabled && !g_eventPoolDestroyed)
+    {
+      EventPoolCache &pool = g_eventPool;
+      EventPoolCache::Block *block = pool.head[index];
+      if (block != 0)
+        {
+          pool.head[index] = block->next;
+          pool.count[index]--;
+          return block;
+        }
+    }
+  /* All the blocks of a size class have the same size, so that any event of the class can reuse them */
+  return ::operator new ((index + 1) * EVENT_POOL_GRANULARITY);
+}
+
+void
+EventImpl::operator delete (void *ptr, size_t size)
+{
+  size_t index = (size - 1) / EVENT_POOL_GRANULARITY;
+  if (index >= EVENT_POOL_CLASSES || g_eventPoolDestroyed)
+    {
+      ::operator delete (ptr);
+      return;
+    }
+  EventPoolCache &pool = g_eventPool;
+  if (!g_eventPoolEnabled || pool.count[index] >= EVENT_POOL_MAX_BLOCKS)
+    {
+      ::operator delete (ptr);
+      return;
+    }
+  EventPoolCache::Block *block = static_cast<EventPoolCache::Block *> (ptr);
+  block->next = pool.head[index];
+  pool.head[index] = block;
+  pool.count[index]++;
+}
+
+void
+EventImpl::SetPoolEnabled (bool enabled)
+{
+  NS_LOG_FUNCTION (enabled);
+  g_eventPoolEnabled = enabled;
+}
+
 EventImpl::~EventImpl ()
 {
   NS_LOG_FUNCTION (this);
@@ -21,6 +21,7 @@
 #define EVENT_IMPL_H
 
 #include <stdint.h>
+#include <cstddef>
 #include "simple-ref-count.h"
 
 /**
@@ -40,6 +41,13 @@ namespace ns3 {
  * when it reaches the time associated to this event. Most subclasses
  * are usually created by one of the many Simulator::Schedule
  * methods.
+ *
+ * The events are small, short-lived objects, so their memory is
+ * recycled by a pool: each thread keeps a free list per size class
+ * (multiples of 16 bytes up to 256 bytes) of the blocks released by
+ * the events it deleted, and allocates the new events from these
+ * lists before falling back to the global allocator. The pool is used
+ * by all the subclasses, including the ones of MakeEvent().
  */
 class EventImpl : public SimpleRefCount<EventImpl>
 {
@@ -65,6 +73,25 @@ public:
    * Checked by the simulation engine before calling Invoke().
    */
   bool IsCancelled (void);
+  /**
+   * Allocate the memory of an event from the pool of the calling thread.
+   * \param [in] size The size of the event.
+   * \returns The allocated memory.
+   */
+  static void * operator new (size_t size);
+  /**
+   * Release the memory of an event to the pool of the calling thread.
+   * \param [in] ptr The memory of the event.
+   * \param [in] size The size of the event.
+   */
+  static void operator delete (void *ptr, size_t size);
+  /**
+   * Enable or disable the event pool, e.g., to benchmark it or to
+   * track the events with a memory checker. The events allocated
+   * while the pool is enabled may be released after it is disabled.
+   * \param [in] enabled Whether the event pool is used.
+   */
+  static void SetPoolEnabled (bool enabled);
 
 protected:
   /**
@@ -0,0 +1,322 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2015-2019 IMDEA Networks Institute
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+
+#include "event-trace-simulator-impl.h"
+#include "event-id.h"
+#include "object-factory.h"
+#include "string.h"
+#include "assert.h"
+#include "log.h"
+
+#include <cstring>
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::EventTraceSimulatorImpl implementation.
+ */
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("EventTraceSimulatorImpl");
+
+NS_OBJECT_ENSURE_REGISTERED (EventTraceSimulatorImpl);
+
+const char EventTraceSimulatorImpl::TRACE_MAGIC[8] = { 'N', 'S', '3', 'E', 'V', 'T', 'R', '1' };
+
+TypeId
+EventTraceSimulatorImpl::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::EventTraceSimulatorImpl")
+    .SetParent<SimulatorImpl> ()
+    .SetGroupName ("Core")
+    .AddConstructor<EventTraceSimulatorImpl> ()
+    .AddAttribute ("Implementation",
+                   "The type of the simulator implementation to record.",
+                   StringValue ("ns3::DefaultSimulatorImpl"),
+                   MakeStringAccessor (&EventTraceSimulatorImpl::m_implType),
+                   MakeStringChecker ())
+    .AddAttribute ("FileName",
+                   "The name of the file to which the events are recorded.",
+                   StringValue ("simulator-events.trace"),
+                   MakeStringAccessor (&EventTraceSimulatorImpl::m_fileName),
+                   MakeStringChecker ())
+  ;
+  return tid;
+}
+
+EventTraceSimulatorImpl::EventTraceSimulatorImpl ()
+  : m_records (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+EventTraceSimulatorImpl::~EventTraceSimulatorImpl ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+EventTraceSimulatorImpl::NotifyConstructionCompleted (void)
+{
+  NS_LOG_FUNCTION (this);
+  SimulatorImpl::NotifyConstructionCompleted ();
+  ObjectFactory factory;
+  factory.SetTypeId (m_implType);
+  m_impl = factory.Create<SimulatorImpl> ();
+  NS_ABORT_MSG_IF (DynamicCast<EventTraceSimulatorImpl> (m_impl) != 0,
+                   "EventTraceSimulatorImpl cannot record itself");
+}
+
+void
+EventTraceSimulatorImpl::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (m_file.is_open ())
+    {
+      m_file.close ();
+    }
+  if (m_impl != 0)
+    {
+      m_impl->Dispose ();
+      m_impl = 0;
+    }
+  SimulatorImpl::DoDispose ();
+}
+
+EventTraceSimulatorImpl::TracedEvent::TracedEvent (EventTraceSimulatorImpl *sim, EventImpl *event)
+  : m_sim (sim),
+    m_event (event, false)
+{
+}
+
+void
+EventTraceSimulatorImpl::TracedEvent::Notify (void)
+{
+  m_sim->Write (EXECUTE, m_sim->Now ().GetTimeStep (), m_sim->GetContext (), 0);
+  m_event->Invoke ();
+}
+
+void
+EventTraceSimulatorImpl::Write (RecordType type, uint64_t ts, uint32_t context, uint32_t uid)
+{
+  if (m_records == 0)
+    {
+      /* The file is only created once an event is recorded, so that the simulator
+       * implementation created by the calls made after Simulator::Destroy does not
+       * overwrite the trace */
+      m_file.open (m_fileName.c_str (), std::ios::out | std::ios::binary | std::ios::trunc);
+      NS_ABORT_MSG_UNLESS (m_file.is_open (), "Cannot open the event trace file " << m_fileName);
+      m_file.write (TRACE_MAGIC, sizeof (TRACE_MAGIC));
+    }
+  uint8_t buffer[RECORD_SIZE];
+  uint8_t *p = buffer;
+  uint64_t now = m_impl->Now ().GetTimeStep ();
+  *p++ = static_cast<uint8_t> (type);
+  std::memcpy (p, &now, sizeof (now));
+  p += sizeof (now);
+  std::memcpy (p, &ts, sizeof (ts));
+  p += sizeof (ts);
+  std::memcpy (p, &context, sizeof (context));
+  p += sizeof (context);
+  std::memcpy (p, &uid, sizeof (uid));
+  m_file.write (reinterpret_cast<const char *> (buffer), RECORD_SIZE);
+  m_records++;
+}
+
+void
+EventTraceSimulatorImpl::Write (RecordType type, const EventId &id)
+{
+  Write (type, id.GetTs (), id.GetContext (), id.GetUid ());
+}
+
+bool
+EventTraceSimulatorImpl::ReadHeader (std::istream &is)
+{
+  char magic[sizeof (TRACE_MAGIC)];
+  is.read (magic, sizeof (magic));
+  return (is.gcount () == sizeof (magic)) && (std::memcmp (magic, TRACE_MAGIC, sizeof (magic)) == 0);
+}
+
+bool
+EventTraceSimulatorImpl::ReadRecord (std::istream &is, Record &record)
+{
+  uint8_t buffer[RECORD_SIZE];
+  is.read (reinterpret_cast<char *> (buffer), RECORD_SIZE);
+  if (is.gcount () != RECORD_SIZE)
+    {
+      return false;
+    }
+  const uint8_t *p = buffer;
+  record.type = static_cast<RecordType> (*p++);
+  std::memcpy (&record.now, p, sizeof (record.now));
+  p += sizeof (record.now);
+  std::memcpy (&record.ts, p, sizeof (record.ts));
+  p += sizeof (record.ts);
+  std::memcpy (&record.context, p, sizeof (record.context));
+  p += sizeof (record.context);
+  std::memcpy (&record.uid, p, sizeof (record.uid));
+  return true;
+}
+
+void
+EventTraceSimulatorImpl::Destroy ()
+{
+  NS_LOG_FUNCTION (this);
+  m_impl->Destroy ();
+  NS_LOG_INFO ("Recorded " << m_records << " event operations to " << m_fileName);
+  if (m_file.is_open ())
+    {
+      m_file.close ();
+    }
+}
+
+bool
+EventTraceSimulatorImpl::IsFinished (void) const
+{
+  return m_impl->IsFinished ();
+}
+
+void
+EventTraceSimulatorImpl::Stop (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_impl->Stop ();
+}
+
+void
+EventTraceSimulatorImpl::Stop (const Time &delay)
+{
+  NS_LOG_FUNCTION (this << delay.GetTimeStep ());
+  m_impl->Stop (delay);
+}
+
+EventId
+EventTraceSimulatorImpl::Schedule (const Time &delay, EventImpl *event)
+{
+  NS_LOG_FUNCTION (this << delay.GetTimeStep () << event);
+  EventId id = m_impl->Schedule (delay, new TracedEvent (this, event));
+  Write (INSERT, id);
+  return id;
+}
+
+void
+EventTraceSimulatorImpl::ScheduleWithContext (uint32_t context, const Time &delay, EventImpl *event)
+{
+  NS_LOG_FUNCTION (this << context << delay.GetTimeStep () << event);
+  Write (INSERT_CONTEXT, (m_impl->Now () + delay).GetTimeStep (), context, 0);
+  m_impl->ScheduleWithContext (context, delay, new TracedEvent (this, event));
+}
+
+EventId
+EventTraceSimulatorImpl::ScheduleNow (EventImpl *event)
+{
+  NS_LOG_FUNCTION (this << event);
+  EventId id = m_impl->ScheduleNow (new TracedEvent (this, event));
+  Write (INSERT, id);
+  return id;
+}
+
+EventId
+EventTraceSimulatorImpl::ScheduleDestroy (EventImpl *event)
+{
+  NS_LOG_FUNCTION (this << event);
+  /* The destroy events are not in the event queue */
+  return m_impl->ScheduleDestroy (event);
+}
+
+void
+EventTraceSimulatorImpl::Remove (const EventId &id)
+{
+  NS_LOG_FUNCTION (this << id.GetUid ());
+  /* uid 2 identifies the destroy events */
+  if (id.GetUid () != 2 && !m_impl->IsExpired (id))
+    {
+      Write (REMOVE, id);
+    }
+  m_impl->Remove (id);
+}
+
+void
+EventTraceSimulatorImpl::Cancel (const EventId &id)
+{
+  NS_LOG_FUNCTION (this << id.GetUid ());
+  if (id.GetUid () != 2 && !m_impl->IsExpired (id))
+    {
+      Write (CANCEL, id);
+    }
+  m_impl->Cancel (id);
+}
+
+bool
+EventTraceSimulatorImpl::IsExpired (const EventId &id) const
+{
+  return m_impl->IsExpired (id);
+}
+
+void
+EventTraceSimulatorImpl::Run (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_impl->Run ();
+  if (m_file.is_open ())
+    {
+      m_file.flush ();
+    }
+}
+
+Time
+EventTraceSimulatorImpl::Now (void) const
+{
+  return m_impl->Now ();
+}
+
+Time
+EventTraceSimulatorImpl::GetDelayLeft (const EventId &id) const
+{
+  return m_impl->GetDelayLeft (id);
+}
+
+Time
+EventTraceSimulatorImpl::GetMaximumSimulationTime (void) const
+{
+  return m_impl->GetMaximumSimulationTime ();
+}
+
+void
+EventTraceSimulatorImpl::SetScheduler (ObjectFactory schedulerFactory)
+{
+  NS_LOG_FUNCTION (this << schedulerFactory);
+  m_impl->SetScheduler (schedulerFactory);
+}
+
+uint32_t
+EventTraceSimulatorImpl::GetSystemId (void) const
+{
+  return m_impl->GetSystemId ();
+}
+
+uint32_t
+EventTraceSimulatorImpl::GetContext (void) const
+{
+  return m_impl->GetContext ();
+}
+
+} // namespace ns3
@@ -0,0 +1,672 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2015-2019 IMDEA Networks Institute
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+
+#include "simulator.h"
+#include "multithreaded-simulator-impl.h"
+#include "scheduler.h"
+#include "event-impl.h"
+
+#include "ptr.h"
+#include "pointer.h"
+#include "uinteger.h"
+#include "assert.h"
+#include "log.h"
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include <unistd.h>
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::MultithreadedSimulatorImpl implementation.
+ */
+
+namespace ns3 {
+
+// Note:  Logging in this file is largely avoided due to the
+// number of calls that are made to these functions and the possibility
+// of causing recursions leading to stack overflow
+NS_LOG_COMPONENT_DEFINE ("MultithreadedSimulatorImpl");
+
+NS_OBJECT_ENSURE_REGISTERED (MultithreadedSimulatorImpl);
+
+thread_local MultithreadedSimulatorImpl::Partition *MultithreadedSimulatorImpl::m_currentPartition = 0;
+
+TypeId
+MultithreadedSimulatorImpl::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::MultithreadedSimulatorImpl")
+    .SetParent<SimulatorImpl> ()
+    .SetGroupName ("Core")
+    .AddConstructor<MultithreadedSimulatorImpl> ()
+    .AddAttribute ("ThreadCount",
+                   "The number of partitions simulated in parallel, each by its own thread. "
+                   "Zero means one partition per online processor.",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&MultithreadedSimulatorImpl::m_threadCount),
+                   MakeUintegerChecker<uint32_t> ())
+    .AddAttribute ("Lookahead",
+                   "The duration of the time windows simulated in parallel. It must not exceed "
+                   "the smallest delay of an event scheduled for a context of another partition, "
+                   "i.e., the minimum propagation delay between two nodes (3 ns is 1 m).",
+                   TimeValue (NanoSeconds (3)),
+                   MakeTimeAccessor (&MultithreadedSimulatorImpl::m_lookahead),
+                   MakeTimeChecker (TimeStep (1)))
+  ;
+  return tid;
+}
+
+MultithreadedSimulatorImpl::MultithreadedSimulatorImpl ()
+  : m_threadCount (0),
+    m_running (false),
+    m_stop (false),
+    m_windows (0),
+    m_nextWorker (0),
+    m_barrierCount (0),
+    m_barrierGeneration (0)
+{
+  NS_LOG_FUNCTION (this);
+  m_main = SystemThread::Self ();
+}
+
+MultithreadedSimulatorImpl::~MultithreadedSimulatorImpl ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+MultithreadedSimulatorImpl::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  for (std::vector<Partition *>::iterator it = m_partitions.begin (); it != m_partitions.end (); it++)
+    {
+      Partition *partition = *it;
+      for (std::vector<Mailbox>::iterator box = partition->inbox.begin (); box != partition->inbox.end (); box++)
+        {
+          for (Mailbox::iterator ev = box->begin (); ev != box->end (); ev++)
+            {
+              ev->event->Unref ();
+            }
+        }
+      for (Mailbox::iterator ev = partition->external.begin (); ev != partition->external.end (); ev++)
+        {
+          ev->event->Unref ();
+        }
+      while (!partition->events->IsEmpty ())
+        {
+          Scheduler::Event next = partition->events->RemoveNext ();
+          next.impl->Unref ();
+        }
+      partition->events = 0;
+      delete partition;
+    }
+  m_partitions.clear ();
+  SimulatorImpl::DoDispose ();
+}
+
+void
+MultithreadedSimulatorImpl::Destroy ()
+{
+  NS_LOG_FUNCTION (this);
+  while (true)
+    {
+      Ptr<EventImpl> ev;
+      {
+        CriticalSection cs (m_destroyEventsMutex);
+        if (m_destroyEvents.empty ())
+          {
+            break;
+          }
+        ev = m_destroyEvents.front ().PeekEventImpl ();
+        m_destroyEvents.pop_front ();
+      }
+      NS_LOG_LOGIC ("handle destroy " << ev);
+      if (!ev->IsCancelled ())
+        {
+          ev->Invoke ();
+        }
+    }
+}
+
+void
+MultithreadedSimulatorImpl::CreatePartitions (void)
+{
+  uint32_t count = m_threadCount;
+  if (count == 0)
+    {
+      count = std::max (1L, sysconf (_SC_NPROCESSORS_ONLN));
+    }
+  NS_LOG_DEBUG ("Create " << count << " partitions");
+  for (uint32_t i = 0; i < count; i++)
+    {
+      Partition *partition = new Partition;
+      partition->index = i;
+      partition->events = m_schedulerFactory.Create<Scheduler> ();
+      // uids are allocated from 4.
+      // uid 0 is "invalid" events
+      // uid 1 is "now" events
+      // uid 2 is "destroy" events
+      partition->uid = 4;
+      // before ::Run is entered, the currentUid will be zero
+      partition->currentUid = 0;
+      partition->currentTs = 0;
+      partition->currentContext = Simulator::NO_CONTEXT;
+      partition->unscheduledEvents = 0;
+      partition->windowEnd = 0;
+      partition->stop = false;
+      partition->stopTs = std::numeric_limits<uint64_t>::max ();
+      partition->inbox.resize (count);
+      partition->nextTs = std::numeric_limits<uint64_t>::max ();
+      partition->publishedStop = false;
+      partition->publishedStopTs = std::numeric_limits<uint64_t>::max ();
+      m_partitions.push_back (partition);
+    }
+}
+
+void
+MultithreadedSimulatorImpl::SetScheduler (ObjectFactory schedulerFactory)
+{
+  NS_LOG_FUNCTION (this << schedulerFactory);
+  m_schedulerFactory = schedulerFactory;
+  if (m_partitions.empty ())
+    {
+      CreatePartitions ();
+      return;
+    }
+  for (std::vector<Partition *>::iterator it = m_partitions.begin (); it != m_partitions.end (); it++)
+    {
+      Ptr<Scheduler> scheduler = schedulerFactory.Create<Scheduler> ();
+      while (!(*it)->events->IsEmpty ())
+        {
+          Scheduler::Event next = (*it)->events->RemoveNext ();
+          scheduler->Insert (next);
+        }
+      (*it)->events = scheduler;
+    }
+}
+
+// System ID for non-distributed simulation is always zero
+uint32_t
+MultithreadedSimulatorImpl::GetSystemId (void) const
+{
+  return 0;
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetThreadCount (void) const
+{
+  return m_partitions.size ();
+}
+
+uint64_t
+MultithreadedSimulatorImpl::GetWindowCount (void) const
+{
+  return m_windows;
+}
+
+MultithreadedSimulatorImpl::Partition *
+MultithreadedSimulatorImpl::GetPartition (uint32_t context) const
+{
+  if (context == Simulator::NO_CONTEXT)
+    {
+      return m_partitions[0];
+    }
+  return m_partitions[context % m_partitions.size ()];
+}
+
+MultithreadedSimulatorImpl::Partition *
+MultithreadedSimulatorImpl::GetCurrentPartition (void) const
+{
+  if (m_currentPartition != 0)
+    {
+      return m_currentPartition;
+    }
+  return m_partitions[0];
+}
+
+Scheduler::Event
+MultithreadedSimulatorImpl::Insert (Partition *partition, uint64_t ts, uint32_t context, EventImpl *event)
+{
+  Scheduler::Event ev;
+  ev.impl = event;
+  ev.key.m_ts = ts;
+  ev.key.m_context = context;
+  ev.key.m_uid = partition->uid;
+  partition->uid++;
+  partition->unscheduledEvents++;
+  partition->events->Insert (ev);
+  return ev;
+}
+
+void
+MultithreadedSimulatorImpl::Synchronize (void)
+{
+  uint32_t threads = m_partitions.size ();
+  if (threads == 1)
+    {
+      return;
+    }
+  uint32_t generation = m_barrierGeneration.load (std::memory_order_acquire);
+  if (m_barrierCount.fetch_add (1, std::memory_order_acq_rel) + 1 == threads)
+    {
+      m_barrierCount.store (0, std::memory_order_relaxed);
+      m_barrierGeneration.fetch_add (1, std::memory_order_release);
+      return;
+    }
+  uint32_t spins = 0;
+  while (m_barrierGeneration.load (std::memory_order_acquire) == generation)
+    {
+      // The windows are short so spin first, but give the processor away if
+      // one of the partitions is busy for a long time.
+      if (++spins > 1024)
+        {
+          std::this_thread::yield ();
+        }
+    }
+}
+
+void
+MultithreadedSimulatorImpl::ProcessMailboxes (Partition *partition)
+{
+  // The mailboxes are drained in the order of the source partitions so the
+  // uids given to the received events do not depend on the thread timings.
+  for (std::vector<Mailbox>::iterator box = partition->inbox.begin (); box != partition->inbox.end (); box++)
+    {
+      for (Mailbox::const_iterator ev = box->begin (); ev != box->end (); ev++)
+        {
+          NS_ASSERT (ev->timestamp >= partition->currentTs);
+          Insert (partition, ev->timestamp, ev->context, ev->event);
+        }
+      box->clear ();
+    }
+
+  Mailbox external;
+  {
+    CriticalSection cs (partition->externalMutex);
+    partition->external.swap (external);
+  }
+  for (Mailbox::const_iterator ev = external.begin (); ev != external.end (); ev++)
+    {
+      Insert (partition, partition->currentTs + ev->timestamp, ev->context, ev->event);
+    }
+
+  partition->nextTs = partition->events->IsEmpty () ? std::numeric_limits<uint64_t>::max ()
+    : partition->events->PeekNext ().key.m_ts;
+  partition->publishedStop = partition->stop;
+  partition->publishedStopTs = partition->stopTs;
+}
+
+void
+MultithreadedSimulatorImpl::ProcessWindow (Partition *partition)
+{
+  while (!partition->events->IsEmpty () && !partition->stop)
+    {
+      if (partition->events->PeekNext ().key.m_ts >= partition->windowEnd)
+        {
+          break;
+        }
+      Scheduler::Event next = partition->events->RemoveNext ();
+
+      NS_ASSERT (next.key.m_ts >= partition->currentTs);
+      partition->unscheduledEvents--;
+
+      NS_LOG_LOGIC ("handle " << next.key.m_ts);
+      partition->currentTs = next.key.m_ts;
+      partition->currentContext = next.key.m_context;
+      partition->currentUid = next.key.m_uid;
+      next.impl->Invoke ();
+      next.impl->Unref ();
+    }
+}
+
+void
+MultithreadedSimulatorImpl::ProcessPartition (Partition *partition)
+{
+  m_currentPartition = partition;
+  uint64_t lookahead = m_lookahead.GetTimeStep ();
+  while (true)
+    {
+      ProcessMailboxes (partition);
+      Synchronize ();
+
+      // Every partition takes the same decision from the state published before the barrier.
+      uint64_t nextTs = std::numeric_limits<uint64_t>::max ();
+      uint64_t stopTs = std::numeric_limits<uint64_t>::max ();
+      bool stop = false;
+      for (std::vector<Partition *>::const_iterator it = m_partitions.begin (); it != m_partitions.end (); it++)
+        {
+          nextTs = std::min (nextTs, (*it)->nextTs);
+          stopTs = std::min (stopTs, (*it)->publishedStopTs);
+          stop = stop || (*it)->publishedStop;
+        }
+      if (stop || nextTs == std::numeric_limits<uint64_t>::max ())
+        {
+          break;
+        }
+      if (stopTs <= nextTs)
+        {
+          partition->windowEnd = nextTs + 1;
+        }
+      else
+        {
+          partition->windowEnd = std::min (nextTs + lookahead, stopTs);
+        }
+      if (partition->index == 0)
+        {
+          m_windows++;
+        }
+
+      ProcessWindow (partition);
+      Synchronize ();
+    }
+  m_currentPartition = 0;
+}
+
+void
+MultithreadedSimulatorImpl::WorkerThread (void)
+{
+  ProcessPartition (m_partitions[m_nextWorker.fetch_add (1)]);
+}
+
+bool
+MultithreadedSimulatorImpl::IsFinished (void) const
+{
+  if (m_stop)
+    {
+      return true;
+    }
+  for (std::vector<Partition *>::const_iterator it = m_partitions.begin (); it != m_partitions.end (); it++)
+    {
+      if ((*it)->stop)
+        {
+          return true;
+        }
+      if (!(*it)->events->IsEmpty ())
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+void
+MultithreadedSimulatorImpl::Run (void)
+{
+  NS_LOG_FUNCTION (this);
+  // Set the current threadId as the main threadId
+  m_main = SystemThread::Self ();
+  m_stop = false;
+  for (std::vector<Partition *>::iterator it = m_partitions.begin (); it != m_partitions.end (); it++)
+    {
+      (*it)->stop = false;
+    }
+
+  NS_LOG_DEBUG ("Run " << m_partitions.size () << " partitions with a lookahead of " << m_lookahead);
+  m_running = true;
+  m_nextWorker.store (1);
+  m_barrierCount.store (0);
+  std::vector<Ptr<SystemThread> > workers;
+  for (uint32_t i = 1; i < m_partitions.size (); i++)
+    {
+      Ptr<SystemThread> worker = Create<SystemThread> (MakeCallback (&MultithreadedSimulatorImpl::WorkerThread, this));
+      worker->Start ();
+      workers.push_back (worker);
+    }
+  ProcessPartition (m_partitions[0]);
+  for (std::vector<Ptr<SystemThread> >::iterator it = workers.begin (); it != workers.end (); it++)
+    {
+      (*it)->Join ();
+    }
+  m_running = false;
+
+  int unscheduledEvents = 0;
+  bool empty = true;
+  for (std::vector<Partition *>::iterator it = m_partitions.begin (); it != m_partitions.end (); it++)
+    {
+      m_stop = m_stop || (*it)->stop;
+      // A stop time which has been reached does not apply to the next run.
+      if ((*it)->stopTs <= (*it)->currentTs)
+        {
+          (*it)->stopTs = std::numeric_limits<uint64_t>::max ();
+        }
+      unscheduledEvents += (*it)->unscheduledEvents;
+      empty = empty && (*it)->events->IsEmpty ();
+    }
+
+  // If the simulator stopped naturally by lack of events, make a
+  // consistency test to check that we didn't lose any events along the way.
+  NS_ASSERT (!empty || unscheduledEvents == 0);
+}
+
+void
+MultithreadedSimulatorImpl::Stop (void)
+{
+  NS_LOG_FUNCTION (this);
+  GetCurrentPartition ()->stop = true;
+}
+
+void
+MultithreadedSimulatorImpl::Stop (Time const &delay)
+{
+  NS_LOG_FUNCTION (this << delay.GetTimeStep ());
+  Partition *partition = GetCurrentPartition ();
+  uint64_t ts = partition->currentTs + delay.GetTimeStep ();
+  partition->stopTs = std::min (partition->stopTs, ts);
+  Simulator::Schedule (delay, &Simulator::Stop);
+}
+
+//
+// Schedule an event for a _relative_ time in the future.
+//
+EventId
+MultithreadedSimulatorImpl::Schedule (Time const &delay, EventImpl *event)
+{
+  NS_LOG_FUNCTION (this << delay.GetTimeStep () << event);
+  NS_ASSERT_MSG (m_currentPartition != 0 || (!m_running && SystemThread::Equals (m_main)), "Simulator::Schedule Thread-unsafe invocation!");
+
+  Partition *partition = GetCurrentPartition ();
+  Time tAbsolute = delay + TimeStep (partition->currentTs);
+
+  NS_ASSERT (tAbsolute.IsPositive ());
+  NS_ASSERT (tAbsolute >= TimeStep (partition->currentTs));
+  Scheduler::Event ev = Insert (partition, tAbsolute.GetTimeStep (), partition->currentContext, event);
+  return EventId (event, ev.key.m_ts, ev.key.m_context, ev.key.m_uid);
+}
+
+void
+MultithreadedSimulatorImpl::ScheduleWithContext (uint32_t context, Time const &delay, EventImpl *event)
+{
+  NS_LOG_FUNCTION (this << context << delay.GetTimeStep () << event);
+
+  Partition *target = GetPartition (context);
+  if (m_currentPartition != 0)
+    {
+      Partition *partition = m_currentPartition;
+      uint64_t ts = partition->currentTs + delay.GetTimeStep ();
+      if (target == partition)
+        {
+          Insert (partition, ts, context, event);
+        }
+      else
+        {
+          NS_ASSERT_MSG (ts >= partition->windowEnd, "Event for context " << context << " scheduled "
+                         << delay << " ahead, which is less than the lookahead " << m_lookahead);
+          EventWithContext ev;
+          ev.context = context;
+          ev.timestamp = ts;
+          ev.event = event;
+          target->inbox[partition->index].push_back (ev);
+        }
+    }
+  else if (!m_running && SystemThread::Equals (m_main))
+    {
+      uint64_t ts = GetCurrentPartition ()->currentTs + delay.GetTimeStep ();
+      NS_ASSERT (ts >= target->currentTs);
+      Insert (target, ts, context, event);
+    }
+  else
+    {
+      EventWithContext ev;
+      ev.context = context;
+      // Current time of the partition added in ProcessMailboxes()
+      ev.timestamp = delay.GetTimeStep ();
+      ev.event = event;
+      {
+        CriticalSection cs (target->externalMutex);
+        target->external.push_back (ev);
+      }
+    }
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleNow (EventImpl *event)
+{
+  NS_ASSERT_MSG (m_currentPartition != 0 || (!m_running && SystemThread::Equals (m_main)), "Simulator::ScheduleNow Thread-unsafe invocation!");
+
+  Partition *partition = GetCurrentPartition ();
+  Scheduler::Event ev = Insert (partition, partition->currentTs, partition->currentContext, event);
+  return EventId (event, ev.key.m_ts, ev.key.m_context, ev.key.m_uid);
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleDestroy (EventImpl *event)
+{
+  EventId id (Ptr<EventImpl> (event, false), GetCurrentPartition ()->currentTs, 0xffffffff, 2);
+  CriticalSection cs (m_destroyEventsMutex);
+  m_destroyEvents.push_back (id);
+  return id;
+}
+
+Time
+MultithreadedSimulatorImpl::Now (void) const
+{
+  // Do not add function logging here, to avoid stack overflow
+  return TimeStep (GetCurrentPartition ()->currentTs);
+}
+
+Time
+MultithreadedSimulatorImpl::GetDelayLeft (const EventId &id) const
+{
+  if (IsExpired (id))
+    {
+      return TimeStep (0);
+    }
+  else
+    {
+      return TimeStep (id.GetTs () - GetPartition (id.GetContext ())->currentTs);
+    }
+}
+
+void
+MultithreadedSimulatorImpl::Remove (const EventId &id)
+{
+  if (id.GetUid () == 2)
+    {
+      // destroy events.
+      CriticalSection cs (m_destroyEventsMutex);
+      for (DestroyEvents::iterator i = m_destroyEvents.begin (); i != m_destroyEvents.end (); i++)
+        {
+          if (*i == id)
+            {
+              m_destroyEvents.erase (i);
+              break;
+            }
+        }
+      return;
+    }
+  if (IsExpired (id))
+    {
+      return;
+    }
+  Partition *partition = GetPartition (id.GetContext ());
+  NS_ASSERT_MSG (!m_running || partition == m_currentPartition, "Simulator::Remove of an event of another partition!");
+  Scheduler::Event event;
+  event.impl = id.PeekEventImpl ();
+  event.key.m_ts = id.GetTs ();
+  event.key.m_context = id.GetContext ();
+  event.key.m_uid = id.GetUid ();
+  partition->events->Remove (event);
+  event.impl->Cancel ();
+  // whenever we remove an event from the event list, we have to unref it.
+  event.impl->Unref ();
+
+  partition->unscheduledEvents--;
+}
+
+void
+MultithreadedSimulatorImpl::Cancel (const EventId &id)
+{
+  if (!IsExpired (id))
+    {
+      id.PeekEventImpl ()->Cancel ();
+    }
+}
+
+bool
+MultithreadedSimulatorImpl::IsExpired (const EventId &id) const
+{
+  if (id.GetUid () == 2)
+    {
+      if (id.PeekEventImpl () == 0 ||
+          id.PeekEventImpl ()->IsCancelled ())
+        {
+          return true;
+        }
+      // destroy events.
+      CriticalSection cs (m_destroyEventsMutex);
+      for (DestroyEvents::const_iterator i = m_destroyEvents.begin (); i != m_destroyEvents.end (); i++)
+        {
+          if (*i == id)
+            {
+              return false;
+            }
+        }
+      return true;
+    }
+  Partition *partition = GetPartition (id.GetContext ());
+  if (id.PeekEventImpl () == 0 ||
+      id.GetTs () < partition->currentTs ||
+      (id.GetTs () == partition->currentTs &&
+       id.GetUid () <= partition->currentUid) ||
+      id.PeekEventImpl ()->IsCancelled ())
+    {
+      return true;
+    }
+  else
+    {
+      return false;
+    }
+}
+
+Time
+MultithreadedSimulatorImpl::GetMaximumSimulationTime (void) const
+{
+  return TimeStep (0x7fffffffffffffffLL);
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetContext (void) const
+{
+  return GetCurrentPartition ()->currentContext;
+}
+
+} // namespace ns3
@@ -0,0 +1,253 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2015-2019 IMDEA Networks Institute
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+
+#ifndef MULTITHREADED_SIMULATOR_IMPL_H
+#define MULTITHREADED_SIMULATOR_IMPL_H
+
+#include "simulator-impl.h"
+#include "scheduler.h"
+#include "event-impl.h"
+#include "system-thread.h"
+#include "system-mutex.h"
+#include "nstime.h"
+
+#include "ptr.h"
+
+#include <atomic>
+#include <list>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::MultithreadedSimulatorImpl declaration.
+ */
+
+namespace ns3 {
+
+/**
+ * \ingroup simulator
+ *
+ * Conservative parallel simulator implementation for shared-memory machines.
+ *
+ * The execution contexts (i.e., the node ids) are partitioned across worker
+ * threads, context \c c being simulated by partition <tt>c % ThreadCount</tt>
+ * and the events without context by partition 0. Each partition owns its event
+ * queue, its current time and its own event uids, so a partition processes the
+ * events of its nodes without any synchronization.
+ *
+ * The partitions advance in time windows. At the start of each window, the
+ * window end is set to the earliest pending event plus the lookahead, and every
+ * partition processes in parallel its events that are strictly before the end
+ * of the window. An event scheduled with Simulator::ScheduleWithContext for a
+ * context of another partition is written to a mailbox owned by the pair of
+ * partitions and inserted into the event queue of the destination at the end
+ * of the window. The lookahead must therefore not exceed the smallest delay of
+ * an interaction between nodes of different partitions, which is usually the
+ * minimum propagation delay of the channel; this is checked by an assertion.
+ *
+ * The mailboxes are only written by the source partition during a window and
+ * only read by the destination partition between two windows, so they require
+ * no lock: the two phases are separated by barriers. The mailboxes are drained
+ * in the order of the source partitions, hence the simulation is deterministic
+ * for a given number of threads.
+ *
+ * Simulator::Stop () stops the partition that calls it immediately and the other
+ * partitions at the end of the current window, while Simulator::Stop (delay) lets
+ * no partition go past the stop time.
+ * The events of a partition may only be cancelled or removed from the same
+ * partition. The objects that are shared between nodes of different partitions
+ * (e.g., the channels or the global counters of the models) must be safe to use
+ * from several threads.
+ */
+class MultithreadedSimulatorImpl : public SimulatorImpl
+{
+public:
+  /**
+   *  Register this type.
+   *  \return The object TypeId.
+   */
+  static TypeId GetTypeId (void);
+
+  /** Constructor. */
+  MultithreadedSimulatorImpl ();
+  /** Destructor. */
+  ~MultithreadedSimulatorImpl ();
+
+  // Inherited
+  virtual void Destroy ();
+  virtual bool IsFinished (void) const;
+  virtual void Stop (void);
+  virtual void Stop (const Time &delay);
+  virtual EventId Schedule (const Time &delay, EventImpl *event);
+  virtual void ScheduleWithContext (uint32_t context, const Time &delay, EventImpl *event);
+  virtual EventId ScheduleNow (EventImpl *event);
+  virtual EventId ScheduleDestroy (EventImpl *event);
+  virtual void Remove (const EventId &id);
+  virtual void Cancel (const EventId &id);
+  virtual bool IsExpired (const EventId &id) const;
+  virtual void Run (void);
+  virtual Time Now (void) const;
+  virtual Time GetDelayLeft (const EventId &id) const;
+  virtual Time GetMaximumSimulationTime (void) const;
+  virtual void SetScheduler (ObjectFactory schedulerFactory);
+  virtual uint32_t GetSystemId (void) const;
+  virtual uint32_t GetContext (void) const;
+
+  /**
+   * \return The number of partitions (worker threads).
+   */
+  uint32_t GetThreadCount (void) const;
+  /**
+   * \return The number of time windows processed so far.
+   */
+  uint64_t GetWindowCount (void) const;
+
+private:
+  virtual void DoDispose (void);
+
+  /** Wrap an event sent to another partition. */
+  struct EventWithContext {
+    /** The event context. */
+    uint32_t context;
+    /** Event timestamp (absolute in a mailbox, relative in the external list). */
+    uint64_t timestamp;
+    /** The event implementation. */
+    EventImpl *event;
+  };
+  /** Container type for the events sent to another partition. */
+  typedef std::vector<EventWithContext> Mailbox;
+
+  /** The state of a partition. */
+  struct Partition {
+    /** The index of the partition. */
+    uint32_t index;
+    /** The event priority queue. */
+    Ptr<Scheduler> events;
+    /** Next event unique id. */
+    uint32_t uid;
+    /** Unique id of the current event. */
+    uint32_t currentUid;
+    /** Timestamp of the current event. */
+    uint64_t currentTs;
+    /** Execution context of the current event. */
+    uint32_t currentContext;
+    /** Number of events that have been inserted but not yet scheduled. */
+    int unscheduledEvents;
+    /** The end (exclusive) of the window being processed. */
+    uint64_t windowEnd;
+    /** Flag set by Simulator::Stop () in this partition. */
+    bool stop;
+    /** The earliest stop time requested in this partition. */
+    uint64_t stopTs;
+    /** The events sent by each partition to this partition during the current window. */
+    std::vector<Mailbox> inbox;
+    /** The events scheduled for this partition by threads which are not workers. */
+    Mailbox external;
+    /** Mutex to control access to the external events. */
+    SystemMutex externalMutex;
+    /** Timestamp of the next event, published between two windows. */
+    uint64_t nextTs;
+    /** Stop flag, published between two windows. */
+    bool publishedStop;
+    /** Stop time, published between two windows. */
+    uint64_t publishedStopTs;
+  };
+
+  /**
+   * \param context The execution context.
+   * \return The partition that simulates the context.
+   */
+  Partition * GetPartition (uint32_t context) const;
+  /**
+   * \return The partition of the calling thread, or partition 0 when called from
+   * the main thread outside Run ().
+   */
+  Partition * GetCurrentPartition (void) const;
+  /** Create the partitions and their event queues. */
+  void CreatePartitions (void);
+  /**
+   * Insert an event in the event queue of a partition.
+   * \param partition The partition.
+   * \param ts The absolute timestamp of the event.
+   * \param context The event context.
+   * \param event The event implementation.
+   * \return The scheduler event.
+   */
+  Scheduler::Event Insert (Partition *partition, uint64_t ts, uint32_t context, EventImpl *event);
+  /** Body of the worker threads. */
+  void WorkerThread (void);
+  /**
+   * Run the windows of a partition until the end of the simulation.
+   * \param partition The partition.
+   */
+  void ProcessPartition (Partition *partition);
+  /**
+   * Move the events received by a partition into its event queue and publish its state.
+   * \param partition The partition.
+   */
+  void ProcessMailboxes (Partition *partition);
+  /**
+   * Process the events of a partition which are before the end of the window.
+   * \param partition The partition.
+   */
+  void ProcessWindow (Partition *partition);
+  /** Wait until all the worker threads reach this point. */
+  void Synchronize (void);
+
+  /** The scheduler factory used for each partition. */
+  ObjectFactory m_schedulerFactory;
+  /** The partitions. */
+  std::vector<Partition *> m_partitions;
+  /** The number of partitions, zero to use one partition per processor. */
+  uint32_t m_threadCount;
+  /** The time window over which the partitions are simulated in parallel. */
+  Time m_lookahead;
+  /** Flag set while the worker threads are running. */
+  bool m_running;
+  /** Flag set when the simulation has been stopped. */
+  bool m_stop;
+  /** The number of time windows processed. */
+  uint64_t m_windows;
+
+  /** The partition simulated by the calling thread. */
+  static thread_local Partition *m_currentPartition;
+
+  /** The index of the next partition to assign to a worker thread. */
+  std::atomic<uint32_t> m_nextWorker;
+  /** The number of threads waiting at the barrier. */
+  std::atomic<uint32_t> m_barrierCount;
+  /** The generation of the barrier, incremented each time all the threads reach it. */
+  std::atomic<uint32_t> m_barrierGeneration;
+
+  /** Container type for the events to run at Simulator::Destroy() */
+  typedef std::list<EventId> DestroyEvents;
+  /** The container of events to run at Destroy. */
+  DestroyEvents m_destroyEvents;
+  /** Mutex to control access to the events to run at Destroy. */
+  mutable SystemMutex m_destroyEventsMutex;
+
+  /** Main execution thread. */
+  SystemThread::ThreadId m_main;
+};
+
+} // namespace ns3
+
+#endif /* MULTITHREADED_SIMULATOR_IMPL_H */
@@ -0,0 +1,100 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2015-2019 IMDEA Networks Institute
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+
+#ifndef QUAD_HEAP_SCHEDULER_H
+#define QUAD_HEAP_SCHEDULER_H
+
+#include "scheduler.h"
+#include <stdint.h>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * ns3::QuadHeapScheduler declaration.
+ */
+
+namespace ns3 {
+
+/**
+ * \ingroup scheduler
+ * \brief a 4-ary heap event scheduler
+ *
+ * The events are stored by value, key included, in a single contiguous
+ * array managed as an implicit 4-ary heap: the children of the entry
+ * \c i are the entries <tt>4i+1</tt> to <tt>4i+4</tt>. Compared to the
+ * binary heap of HeapScheduler, the heap is half as deep and the four
+ * children of an entry share one or two cache lines, so removing the
+ * next event touches fewer cache lines; insertion and removal of the
+ * next event stay logarithmic whatever the distribution of the event
+ * times, which suits the mix of sub-microsecond and long timers of the
+ * DMG simulations. Entries are moved with the hole technique instead of
+ * pairwise exchanges.
+ *
+ * Removing an arbitrary (cancelled) event requires a linear search, as
+ * with HeapScheduler.
+ */
+class QuadHeapScheduler : public Scheduler
+{
+public:
+  /**
+   *  Register this type.
+   *  \return The object TypeId.
+   */
+  static TypeId GetTypeId (void);
+
+  /** Constructor. */
+  QuadHeapScheduler ();
+  /** Destructor. */
+  virtual ~QuadHeapScheduler ();
+
+  // Inherited
+  virtual void Insert (const Scheduler::Event &ev);
+  virtual bool IsEmpty (void) const;
+  virtual Scheduler::Event PeekNext (void) const;
+  virtual Scheduler::Event RemoveNext (void);
+  virtual void Remove (const Scheduler::Event &ev);
+
+private:
+  /** Event list type: vector of Events, managed as a 4-ary heap. */
+  typedef std::vector<Scheduler::Event> QuadHeap;
+
+  /**
+   * Move an event towards the root until its parent is smaller.
+   *
+   * \param [in] index The index of the hole where the event was.
+   * \param [in] ev The event to place.
+   */
+  void SiftUp (uint32_t index, const Scheduler::Event &ev);
+  /**
+   * Move an event towards the leaves until its children are larger.
+   *
+   * \param [in] index The index of the hole where the event was.
+   * \param [in] ev The event to place.
+   */
+  void SiftDown (uint32_t index, const Scheduler::Event &ev);
+
+  /** The event list. */
+  QuadHeap m_heap;
+};
+
+} // namespace ns3
+
+#endif /* QUAD_HEAP_SCHEDULER_H */
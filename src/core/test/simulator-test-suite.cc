@@ -23,6 +23,13 @@
 #include "ns3/heap-scheduler.h"
 #include "ns3/map-scheduler.h"
 #include "ns3/calendar-scheduler.h"
+#include "ns3/quad-heap-scheduler.h"
+#include "ns3/event-trace-simulator-impl.h"
+#include "ns3/global-value.h"
+#include "ns3/config.h"
+#include "ns3/string.h"
+
+#include <fstream>
 
 using namespace ns3;
 
@@ -459,6 +466,60 @@ SimulatorTemplateTestCase::DoRun (void)
   Simulator::Destroy ();
 }
 
+class SimulatorEventTraceTestCase : public TestCase
+{
+public:
+  SimulatorEventTraceTestCase ();
+  virtual void DoRun (void);
+  void Event (void);
+};
+
+SimulatorEventTraceTestCase::SimulatorEventTraceTestCase ()
+  : TestCase ("Check that the event trace records the operations on the event queue")
+{
+}
+
+void
+SimulatorEventTraceTestCase::Event (void)
+{
+}
+
+void
+SimulatorEventTraceTestCase::DoRun (void)
+{
+  std::string fileName = CreateTempDirFilename ("simulator-events.trace");
+  Config::SetDefault ("ns3::EventTraceSimulatorImpl::FileName", StringValue (fileName));
+  GlobalValue::Bind ("SimulatorImplementationType", StringValue ("ns3::EventTraceSimulatorImpl"));
+
+  Simulator::Schedule (MicroSeconds (10), &SimulatorEventTraceTestCase::Event, this);
+  EventId id = Simulator::Schedule (MicroSeconds (20), &SimulatorEventTraceTestCase::Event, this);
+  Simulator::ScheduleWithContext (1, MicroSeconds (30), &SimulatorEventTraceTestCase::Event, this);
+  Simulator::Cancel (id);
+  Simulator::Run ();
+  Simulator::Destroy ();
+  GlobalValue::Bind ("SimulatorImplementationType", StringValue ("ns3::DefaultSimulatorImpl"));
+
+  std::ifstream is (fileName.c_str (), std::ios::binary);
+  NS_TEST_ASSERT_MSG_EQ (EventTraceSimulatorImpl::ReadHeader (is), true, "Not a trace file");
+  uint32_t count[EventTraceSimulatorImpl::EXECUTE + 1] = {0};
+  uint64_t lastExecute = 0;
+  EventTraceSimulatorImpl::Record record;
+  while (EventTraceSimulatorImpl::ReadRecord (is, record))
+    {
+      count[record.type]++;
+      if (record.type == EventTraceSimulatorImpl::EXECUTE)
+        {
+          NS_TEST_ASSERT_MSG_EQ (record.ts, record.now, "Event executed at the wrong time");
+          lastExecute = record.ts;
+        }
+    }
+  NS_TEST_ASSERT_MSG_EQ (count[EventTraceSimulatorImpl::INSERT], 2, "Wrong number of inserts");
+  NS_TEST_ASSERT_MSG_EQ (count[EventTraceSimulatorImpl::INSERT_CONTEXT], 1, "Wrong number of context inserts");
+  NS_TEST_ASSERT_MSG_EQ (count[EventTraceSimulatorImpl::CANCEL], 1, "Wrong number of cancels");
+  NS_TEST_ASSERT_MSG_EQ (count[EventTraceSimulatorImpl::EXECUTE], 2, "Wrong number of executions");
+  NS_TEST_ASSERT_MSG_EQ (lastExecute, (uint64_t) MicroSeconds (30).GetTimeStep (), "Wrong time of the last event");
+}
+
 class SimulatorTestSuite : public TestSuite
 {
 public:
@@ -475,5 +536,8 @@ public:
     AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
     factory.SetTypeId (CalendarScheduler::GetTypeId ());
     AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
+    factory.SetTypeId (QuadHeapScheduler::GetTypeId ());
+    AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
+    AddTestCase (new SimulatorEventTraceTestCase (), TestCase::QUICK);
   }
 } g_simulatorTestSuite;
@@ -25,11 +25,15 @@
 #include "ns3/calendar-scheduler.h"
 #include "ns3/config.h"
 #include "ns3/string.h"
+#include "ns3/uinteger.h"
+#include "ns3/nstime.h"
 #include "ns3/system-thread.h"
 
+#include <algorithm>
 #include <ctime>
 #include <list>
 #include <utility>
+#include <vector>
 
 using namespace ns3;
 
@@ -225,6 +229,93 @@ ThreadedSimulatorEventsTestCase::DoRun (void)
   NS_TEST_EXPECT_MSG_EQ (m_a, m_d, "Bad scheduling");
 }
 
+#define NCONTEXTS 8
+
+class MultithreadedSimulatorPartitionsTestCase : public TestCase
+{
+public:
+  MultithreadedSimulatorPartitionsTestCase (unsigned int threads);
+  void Hop (uint32_t context, unsigned int hops);
+  std::vector<Time> m_arrivals[NCONTEXTS];
+  bool m_badContext;
+  unsigned int m_threads;
+
+private:
+  virtual void DoSetup (void);
+  virtual void DoRun (void);
+  virtual void DoTeardown (void);
+};
+
+MultithreadedSimulatorPartitionsTestCase::MultithreadedSimulatorPartitionsTestCase (unsigned int threads)
+  : TestCase ("Check that events cross the partitions of ns3::MultithreadedSimulatorImpl at the right time"),
+    m_badContext (false),
+    m_threads (threads)
+{
+}
+
+void
+MultithreadedSimulatorPartitionsTestCase::Hop (uint32_t context, unsigned int hops)
+{
+  //Each context is simulated by a single partition so its own vector is never shared
+  if (Simulator::GetContext () != context)
+    {
+      m_badContext = true;
+    }
+  m_arrivals[context].push_back (Simulator::Now ());
+  if (hops > 0)
+    {
+      uint32_t next = (context + 1) % NCONTEXTS;
+      Simulator::ScheduleWithContext (next, MicroSeconds (1),
+                                      &MultithreadedSimulatorPartitionsTestCase::Hop, this, next, hops - 1);
+      Simulator::Schedule (NanoSeconds (100), &MultithreadedSimulatorPartitionsTestCase::Hop, this, context, 0);
+    }
+}
+
+void
+MultithreadedSimulatorPartitionsTestCase::DoSetup (void)
+{
+  Config::SetGlobal ("SimulatorImplementationType", StringValue ("ns3::MultithreadedSimulatorImpl"));
+  Config::SetDefault ("ns3::MultithreadedSimulatorImpl::ThreadCount", UintegerValue (m_threads));
+  Config::SetDefault ("ns3::MultithreadedSimulatorImpl::Lookahead", TimeValue (MicroSeconds (1)));
+}
+
+void
+MultithreadedSimulatorPartitionsTestCase::DoTeardown (void)
+{
+  Config::SetDefault ("ns3::MultithreadedSimulatorImpl::ThreadCount", UintegerValue (0));
+  Config::SetDefault ("ns3::MultithreadedSimulatorImpl::Lookahead", TimeValue (NanoSeconds (3)));
+  Config::SetGlobal ("SimulatorImplementationType", StringValue ("ns3::DefaultSimulatorImpl"));
+}
+
+void
+MultithreadedSimulatorPartitionsTestCase::DoRun (void)
+{
+  for (uint32_t i = 0; i < NCONTEXTS; i++)
+    {
+      Simulator::ScheduleWithContext (i, MicroSeconds (i), &MultithreadedSimulatorPartitionsTestCase::Hop, this, i, 3 * NCONTEXTS);
+    }
+  Simulator::Stop (MicroSeconds (20));
+  Simulator::Run ();
+  Time stopTime = Simulator::Now ();
+  Simulator::Destroy ();
+
+  NS_TEST_EXPECT_MSG_EQ (m_badContext, false, "Event executed with the wrong context");
+  NS_TEST_EXPECT_MSG_EQ (stopTime, MicroSeconds (20), "Simulation not stopped at the stop time");
+  for (uint32_t i = 0; i < NCONTEXTS; i++)
+    {
+      for (uint32_t j = 1; j < m_arrivals[i].size (); j++)
+        {
+          NS_TEST_EXPECT_MSG_GT_OR_EQ (m_arrivals[i][j], m_arrivals[i][j - 1], "Events executed out of order");
+        }
+      NS_TEST_EXPECT_MSG_LT_OR_EQ (m_arrivals[i].back (), MicroSeconds (20), "Event executed after the stop time");
+    }
+  //Context i starts a chain at i us which reaches context 0 after NCONTEXTS - i hops of 1 us,
+  //so all the chains cross each other in context 0 at NCONTEXTS us
+  NS_TEST_EXPECT_MSG_EQ (m_arrivals[0][1], NanoSeconds (100), "Wrong local event time");
+  NS_TEST_EXPECT_MSG_EQ (std::count (m_arrivals[0].begin (), m_arrivals[0].end (), MicroSeconds (NCONTEXTS)), NCONTEXTS,
+                         "Wrong arrival time of the chains crossing the partitions");
+}
+
 class ThreadedSimulatorTestSuite : public TestSuite
 {
 public:
@@ -235,13 +326,15 @@ public:
 #ifdef HAVE_RT
       "ns3::RealtimeSimulatorImpl",
 #endif
-      "ns3::DefaultSimulatorImpl"
+      "ns3::DefaultSimulatorImpl",
+      "ns3::MultithreadedSimulatorImpl"
     };
     std::string schedulerTypes[] = {
       "ns3::ListScheduler",
       "ns3::HeapScheduler",
       "ns3::MapScheduler",
-      "ns3::CalendarScheduler"
+      "ns3::CalendarScheduler",
+      "ns3::QuadHeapScheduler"
     };
     unsigned int threadcounts[] = {
       0,
@@ -262,5 +355,7 @@ public:
               }
           }
       }
+    AddTestCase (new MultithreadedSimulatorPartitionsTestCase (1), TestCase::QUICK);
+    AddTestCase (new MultithreadedSimulatorPartitionsTestCase (3), TestCase::QUICK);
   }
 } g_threadedSimulatorTestSuite;
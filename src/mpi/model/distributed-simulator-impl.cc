@@ -229,6 +229,23 @@ DistributedSimulatorImpl::CalculateLookAhead (void)
                 }
             }
         }
+
+      // channels shared with the nodes of other tasks, e.g. wireless channels
+      for (uint32_t i = 0; i < MpiInterface::GetNRemoteChannels (); ++i)
+        {
+          for (uint32_t systemId = 0; systemId < MpiInterface::GetSize (); ++systemId)
+            {
+              if (systemId == MpiInterface::GetSystemId ())
+                {
+                  continue;
+                }
+              Time delay = MpiInterface::GetRemoteChannelDelay (i, systemId);
+              if (!delay.IsNegative () && delay < m_lookAhead)
+                {
+                  m_lookAhead = delay;
+                }
+            }
+        }
     }
 
   // m_lookAhead is now set
@@ -33,6 +33,8 @@ namespace ns3 {
 NS_LOG_COMPONENT_DEFINE ("MpiInterface");
 
 ParallelCommunicationInterface* MpiInterface::g_parallelCommunicationInterface = 0;
+std::vector<Ptr<Channel> > MpiInterface::g_remoteChannels;
+std::vector<MpiInterface::RemoteDelayCallback> MpiInterface::g_remoteDelays;
 
 void
 MpiInterface::Destroy ()
@@ -115,6 +117,34 @@ MpiInterface::SendPacket (Ptr<Packet> p, const Time& rxTime, uint32_t node, uint
   g_parallelCommunicationInterface->SendPacket (p, rxTime, node, dev);
 }
 
+void
+MpiInterface::AddRemoteChannel (Ptr<Channel> channel, RemoteDelayCallback delay)
+{
+  NS_LOG_FUNCTION (channel);
+  g_remoteChannels.push_back (channel);
+  g_remoteDelays.push_back (delay);
+}
+
+uint32_t
+MpiInterface::GetNRemoteChannels (void)
+{
+  return g_remoteChannels.size ();
+}
+
+Ptr<Channel>
+MpiInterface::GetRemoteChannel (uint32_t i)
+{
+  NS_ASSERT (i < g_remoteChannels.size ());
+  return g_remoteChannels[i];
+}
+
+Time
+MpiInterface::GetRemoteChannelDelay (uint32_t i, uint32_t systemId)
+{
+  NS_ASSERT (i < g_remoteDelays.size ());
+  return g_remoteDelays[i] (systemId);
+}
+
 
 void
 MpiInterface::Disable ()
@@ -123,6 +153,8 @@ MpiInterface::Disable ()
   g_parallelCommunicationInterface->Disable ();
   delete g_parallelCommunicationInterface;
   g_parallelCommunicationInterface = 0;
+  g_remoteChannels.clear ();
+  g_remoteDelays.clear ();
 }
 
 
@@ -24,6 +24,10 @@
 
 #include <ns3/nstime.h>
 #include <ns3/packet.h>
+#include <ns3/channel.h>
+#include <ns3/callback.h>
+
+#include <vector>
 
 namespace ns3 {
 /**
@@ -50,6 +54,14 @@ class ParallelCommunicationInterface;
 class MpiInterface
 {
 public:
+  /**
+   * Callback returning the minimum delay after which a transmission of a
+   * node of this task reaches, over a channel, a node of the task given
+   * as argument; a negative delay means that the channel does not connect
+   * the two tasks.
+   */
+  typedef Callback<Time, uint32_t> RemoteDelayCallback;
+
   /**
    * Deletes storage used by the parallel environment.
    */
@@ -94,12 +106,47 @@ public:
    * Serialize and send a packet to the specified node and net device
    */
   static void SendPacket (Ptr<Packet> p, const Time &rxTime, uint32_t node, uint32_t dev);
+  /**
+   * \param channel the channel
+   * \param delay the callback returning the delay of the channel towards another task
+   *
+   * Register a channel which is not point-to-point (e.g., a wireless channel
+   * shared by nodes of several tasks) and which delivers its transmissions
+   * to the other tasks through SendPacket.  The parallel simulators use the
+   * delay of the registered channels, in addition to the delay of the
+   * point-to-point links, to compute their lookahead.
+   */
+  static void AddRemoteChannel (Ptr<Channel> channel, RemoteDelayCallback delay);
+  /**
+   * \return the number of channels registered with AddRemoteChannel
+   */
+  static uint32_t GetNRemoteChannels (void);
+  /**
+   * \param i the index of the registered channel
+   * \return the registered channel
+   */
+  static Ptr<Channel> GetRemoteChannel (uint32_t i);
+  /**
+   * \param i the index of the registered channel
+   * \param systemId the remote task
+   * \return the minimum delay of the channel towards the remote task,
+   * or a negative delay if the channel does not reach the remote task
+   */
+  static Time GetRemoteChannelDelay (uint32_t i, uint32_t systemId);
 private:
 
   /**
    * Static instance of the instantiated parallel controller.
    */
   static ParallelCommunicationInterface* g_parallelCommunicationInterface;
+  /**
+   * Channels shared with other tasks which are not point-to-point.
+   */
+  static std::vector<Ptr<Channel> > g_remoteChannels;
+  /**
+   * The delay callbacks of the channels shared with other tasks.
+   */
+  static std::vector<RemoteDelayCallback> g_remoteDelays;
 };
 
 } // namespace ns3
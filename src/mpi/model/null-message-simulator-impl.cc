@@ -199,6 +199,32 @@ NullMessageSimulatorImpl::CalculateLookAhead (void)
               remoteChannelBundle->AddChannel (channel, delay.Get () );
             }
         }
+
+      /**
+       * Add the channels shared with the nodes of other tasks, e.g. wireless channels,
+       * to the remote channel bundles of the tasks they reach.
+       */
+      for (uint32_t i = 0; i < MpiInterface::GetNRemoteChannels (); ++i)
+        {
+          for (uint32_t systemId = 0; systemId < MpiInterface::GetSize (); ++systemId)
+            {
+              if (systemId == MpiInterface::GetSystemId ())
+                {
+                  continue;
+                }
+              Time delay = MpiInterface::GetRemoteChannelDelay (i, systemId);
+              if (delay.IsNegative ())
+                {
+                  continue;
+                }
+              Ptr<RemoteChannelBundle> remoteChannelBundle = RemoteChannelBundleManager::Find (systemId);
+              if (!remoteChannelBundle)
+                {
+                  remoteChannelBundle = RemoteChannelBundleManager::Add (systemId);
+                }
+              remoteChannelBundle->AddChannel (MpiInterface::GetRemoteChannel (i), delay);
+            }
+        }
     }
 
   // Completed setup of remote channel bundles.  Setup send and receive buffers.
@@ -41,4 +41,10 @@ NetDevice::~NetDevice ()
   NS_LOG_FUNCTION (this);
 }
 
+void
+NetDevice::SetReceiveBurstCallback (ReceiveBurstCallback cb)
+{
+  NS_LOG_FUNCTION (this);
+}
+
 } // namespace ns3
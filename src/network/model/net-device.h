@@ -22,6 +22,7 @@
 #define NET_DEVICE_H
 
 #include <stdint.h>
+#include <vector>
 #include "ns3/callback.h"
 #include "ns3/object.h"
 #include "ns3/ptr.h"
@@ -326,6 +327,27 @@ public:
    */
   virtual void SetReceiveCallback (ReceiveCallback cb) = 0;
 
+  /**
+   * \param device a pointer to the net device which is calling this callback
+   * \param packets the packets received, in order of reception
+   * \param protocol the 16 bit protocol number associated with all the packets.
+   * \param sender the address of the sender of all the packets
+   * \returns true if the callback could handle the packets successfully, false
+   *          otherwise.
+   */
+  typedef Callback< bool, Ptr<NetDevice>, const std::vector<Ptr<const Packet> > &, uint16_t, const Address & > ReceiveBurstCallback;
+
+  /**
+   * \param cb callback to invoke whenever a burst of packets with the same
+   *        protocol and sender has been received at once (e.g. the MSDUs of an
+   *        aggregate frame) and must be forwarded to the higher layers.
+   *
+   * The default implementation ignores the callback: devices which do not deliver
+   * bursts keep forwarding each packet through the ReceiveCallback, and so do the
+   * devices which support bursts as long as this callback is not set.
+   */
+  virtual void SetReceiveBurstCallback (ReceiveBurstCallback cb);
+
 
   /**
    * \param device a pointer to the net device which is calling this callback
@@ -133,6 +133,7 @@ Node::AddDevice (Ptr<NetDevice> device)
   device->SetNode (this);
   device->SetIfIndex (index);
   device->SetReceiveCallback (MakeCallback (&Node::NonPromiscReceiveFromDevice, this));
+  device->SetReceiveBurstCallback (MakeCallback (&Node::NonPromiscReceiveBurstFromDevice, this));
   Simulator::ScheduleWithContext (GetId (), Seconds (0.0), 
                                   &NetDevice::Initialize, device);
   NotifyDeviceAdded (device);
@@ -297,6 +298,41 @@ Node::NonPromiscReceiveFromDevice (Ptr<NetDevice> device, Ptr<const Packet> pack
   return ReceiveFromDevice (device, packet, protocol, from, device->GetAddress (), NetDevice::PacketType (0), false);
 }
 
+bool
+Node::NonPromiscReceiveBurstFromDevice (Ptr<NetDevice> device, const std::vector<Ptr<const Packet> > &packets,
+                                        uint16_t protocol, const Address &from)
+{
+  NS_LOG_FUNCTION (this << device << packets.size () << protocol << &from);
+  NS_ASSERT_MSG (Simulator::GetContext () == GetId (), "Received packet with erroneous context ; " <<
+                 "make sure the channels in use are correctly updating events context " <<
+                 "when transfering events from one node to another.");
+  /* The handlers may register other handlers, so keep a copy of the matching ones */
+  std::vector<ProtocolHandler> handlers;
+  for (ProtocolHandlerList::iterator i = m_handlers.begin ();
+       i != m_handlers.end (); i++)
+    {
+      if ((i->device == 0 || i->device == device)
+          && (i->protocol == 0 || i->protocol == protocol)
+          && !i->promiscuous)
+        {
+          handlers.push_back (i->handler);
+        }
+    }
+  Address to = device->GetAddress ();
+  for (std::vector<Ptr<const Packet> >::const_iterator packet = packets.begin ();
+       packet != packets.end (); packet++)
+    {
+      NS_LOG_DEBUG ("Node " << GetId () << " ReceiveBurstFromDevice:  dev "
+                            << device->GetIfIndex () << " Packet UID " << (*packet)->GetUid ());
+      for (std::vector<ProtocolHandler>::iterator handler = handlers.begin ();
+           handler != handlers.end (); handler++)
+        {
+          (*handler) (device, *packet, protocol, from, to, NetDevice::PacketType (0));
+        }
+    }
+  return !handlers.empty ();
+}
+
 bool
 Node::ReceiveFromDevice (Ptr<NetDevice> device, Ptr<const Packet> packet, uint16_t protocol,
                          const Address &from, const Address &to, NetDevice::PacketType packetType, bool promiscuous)
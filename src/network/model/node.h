@@ -235,6 +235,20 @@ private:
    * \returns true if the packet has been delivered to a protocol handler.
    */
   bool NonPromiscReceiveFromDevice (Ptr<NetDevice> device, Ptr<const Packet> packet, uint16_t protocol, const Address &from);
+  /**
+   * \brief Receive a burst of packets from a device in non-promiscuous mode.
+   *
+   * The protocol handlers are looked up once for the whole burst, then each
+   * packet is delivered in turn as NonPromiscReceiveFromDevice would do.
+   *
+   * \param device the device
+   * \param packets the packets
+   * \param protocol the protocol of all the packets
+   * \param from the sender of all the packets
+   * \returns true if the packets have been delivered to a protocol handler.
+   */
+  bool NonPromiscReceiveBurstFromDevice (Ptr<NetDevice> device, const std::vector<Ptr<const Packet> > &packets,
+                                         uint16_t protocol, const Address &from);
   /**
    * \brief Receive a packet from a device in promiscuous mode.
    * \param device the device
@@ -0,0 +1,234 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2015-2019 IMDEA Networks Institute
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+
+#include "packet-memory-pool.h"
+#include "ns3/log.h"
+#include "ns3/assert.h"
+
+#include <algorithm>
+#include <new>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("PacketMemoryPool");
+
+namespace {
+
+/** The log2 of the size of the smallest size class. */
+const uint32_t POOL_MIN_CLASS_BITS = 6;
+/** The number of power of two size classes (64 bytes to 128 KiB). */
+const uint32_t POOL_POWER_CLASSES = 12;
+/** The size of the last class, which holds a maximum size DMG A-MPDU and its headers. */
+const uint32_t POOL_AMPDU_CLASS_SIZE = 260 * 1024;
+/** The number of size classes. */
+const uint32_t POOL_CLASSES = POOL_POWER_CLASSES + 1;
+/** The number of bytes a thread keeps at most in the free list of a class. */
+const uint32_t POOL_CLASS_BUDGET = 1024 * 1024;
+/** The number of blocks a thread keeps at most in the free list of a class. */
+const uint32_t POOL_MAX_BLOCKS = 1024;
+
+/** Whether the released blocks are recycled. */
+bool g_packetPoolEnabled = true;
+
+/**
+ * \param size A block size.
+ * \return The size class of the block, or POOL_CLASSES if it is too large for the pool.
+ */
+inline uint32_t
+GetSizeClass (uint32_t size)
+{
+  if (size <= (1u << POOL_MIN_CLASS_BITS))
+    {
+      return 0;
+    }
+  uint32_t bits = 32 - __builtin_clz (size - 1);
+  if (bits < POOL_MIN_CLASS_BITS + POOL_POWER_CLASSES)
+    {
+      return bits - POOL_MIN_CLASS_BITS;
+    }
+  return (size <= POOL_AMPDU_CLASS_SIZE) ? POOL_POWER_CLASSES : POOL_CLASSES;
+}
+
+/**
+ * \param sizeClass A size class.
+ * \return The size of the blocks of the class.
+ */
+inline uint32_t
+GetClassSize (uint32_t sizeClass)
+{
+  return (sizeClass < POOL_POWER_CLASSES) ? (1u << (sizeClass + POOL_MIN_CLASS_BITS)) : POOL_AMPDU_CLASS_SIZE;
+}
+
+/**
+ * \ingroup packet
+ * The free lists and the statistics of the packet pool of a thread.
+ */
+struct PacketPoolCache
+{
+  /** A free block, linked to the next free block of the same size class. */
+  struct Block
+  {
+    Block *next;  /**< The next free block. */
+  };
+
+  PacketPoolCache ();
+  ~PacketPoolCache ();
+
+  Block *head[POOL_CLASSES];      /**< The free blocks of each size class. */
+  uint32_t count[POOL_CLASSES];   /**< The number of free blocks of each size class. */
+  PacketMemoryPool::Statistics stats[PacketMemoryPool::CLIENT_COUNT];  /**< The statistics of each client. */
+};
+
+/** Flag set once the pool of the thread has been destroyed, at thread exit. */
+thread_local bool g_packetPoolDestroyed = false;
+/** The packet pool of the thread. */
+thread_local PacketPoolCache g_packetPool;
+
+PacketPoolCache::PacketPoolCache ()
+{
+  for (uint32_t i = 0; i < POOL_CLASSES; i++)
+    {
+      head[i] = 0;
+      count[i] = 0;
+    }
+  for (uint32_t i = 0; i < PacketMemoryPool::CLIENT_COUNT; i++)
+    {
+      stats[i] = PacketMemoryPool::Statistics ();
+    }
+}
+
+PacketPoolCache::~PacketPoolCache ()
+{
+  for (uint32_t i = 0; i < POOL_CLASSES; i++)
+    {
+      while (head[i] != 0)
+        {
+          Block *block = head[i];
+          head[i] = block->next;
+          ::operator delete (block);
+        }
+      count[i] = 0;
+    }
+  /* The packets released after this point (e.g., by static destructors) bypass the pool */
+  g_packetPoolDestroyed = true;
+}
+
+} // unnamed namespace
+
+void *
+PacketMemoryPool::Allocate (Client client, uint32_t size, uint32_t &capacity)
+{
+  uint32_t sizeClass = GetSizeClass (size);
+  if (sizeClass == POOL_CLASSES)
+    {
+      capacity = size;
+      return ::operator new (size);
+    }
+  /* All the blocks of a class have the size of the class, so that any request of the class can reuse them */
+  capacity = GetClassSize (sizeClass);
+  if (g_packetPoolDestroyed)
+    {
+      return ::operator new (capacity);
+    }
+  PacketPoolCache &pool = g_packetPool;
+  pool.stats[client].allocations++;
+  PacketPoolCache::Block *block = pool.head[sizeClass];
+  if (block != 0)
+    {
+      pool.head[sizeClass] = block->next;
+      pool.count[sizeClass]--;
+      pool.stats[client].reused++;
+      return block;
+    }
+  return ::operator new (capacity);
+}
+
+void
+PacketMemoryPool::Deallocate (Client client, void *block, uint32_t size)
+{
+  uint32_t sizeClass = GetSizeClass (size);
+  if (sizeClass == POOL_CLASSES || g_packetPoolDestroyed)
+    {
+      ::operator delete (block);
+      return;
+    }
+  PacketPoolCache &pool = g_packetPool;
+  pool.stats[client].releases++;
+  uint32_t maxBlocks = std::max<uint32_t> (4, std::min (POOL_MAX_BLOCKS, POOL_CLASS_BUDGET / GetClassSize (sizeClass)));
+  if (!g_packetPoolEnabled || pool.count[sizeClass] >= maxBlocks)
+    {
+      ::operator delete (block);
+      return;
+    }
+  PacketPoolCache::Block *freeBlock = static_cast<PacketPoolCache::Block *> (block);
+  freeBlock->next = pool.head[sizeClass];
+  pool.head[sizeClass] = freeBlock;
+  pool.count[sizeClass]++;
+  pool.stats[client].recycled++;
+}
+
+void
+PacketMemoryPool::SetEnabled (bool enabled)
+{
+  NS_LOG_FUNCTION (enabled);
+  g_packetPoolEnabled = enabled;
+}
+
+PacketMemoryPool::Statistics
+PacketMemoryPool::GetStatistics (Client client)
+{
+  NS_ASSERT (client < CLIENT_COUNT);
+  if (g_packetPoolDestroyed)
+    {
+      return Statistics ();
+    }
+  return g_packetPool.stats[client];
+}
+
+uint64_t
+PacketMemoryPool::GetCachedBytes (void)
+{
+  if (g_packetPoolDestroyed)
+    {
+      return 0;
+    }
+  uint64_t bytes = 0;
+  for (uint32_t i = 0; i < POOL_CLASSES; i++)
+    {
+      bytes += static_cast<uint64_t> (g_packetPool.count[i]) * GetClassSize (i);
+    }
+  return bytes;
+}
+
+void
+PacketMemoryPool::ResetStatistics (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  if (g_packetPoolDestroyed)
+    {
+      return;
+    }
+  for (uint32_t i = 0; i < CLIENT_COUNT; i++)
+    {
+      g_packetPool.stats[i] = Statistics ();
+    }
+}
+
+} // namespace ns3
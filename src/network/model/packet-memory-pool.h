@@ -0,0 +1,108 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2015-2019 IMDEA Networks Institute
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+
+#ifndef PACKET_MEMORY_POOL_H
+#define PACKET_MEMORY_POOL_H
+
+#include <stdint.h>
+
+namespace ns3 {
+
+/**
+ * \ingroup packet
+ *
+ * \brief Size-class memory pool for the variable-sized storage of the packets.
+ *
+ * The byte buffers (Buffer::Data), the metadata (PacketMetadata::Data) and
+ * the packet tags (PacketTagList::TagData) are allocated from this pool. A
+ * request is rounded up to a size class and served from the free list of the
+ * class before falling back to the global allocator, and a released block is
+ * kept in the free list of its class up to a per-class budget. The caller is
+ * told the capacity of the block, so a buffer can grow within its block.
+ *
+ * The size classes are the powers of two from 64 bytes to 128 KiB, plus a
+ * class of 260 KiB which holds the largest DMG A-MPDU (262143 bytes) with its
+ * headers. A 7920-byte DMG MSDU with its MAC and A-MSDU subframe headers fits
+ * in the 8 KiB class, and the SSW, Grant and other control frames in the
+ * smallest ones. Larger requests go to the global allocator.
+ *
+ * The free lists and the statistics belong to the calling thread, so the pool
+ * needs no lock when the packets are handled by several threads; a block
+ * released by another thread than the one which allocated it joins the free
+ * lists of the releasing thread.
+ */
+class PacketMemoryPool
+{
+public:
+  /** The users of the pool, for which statistics are kept. */
+  enum Client
+  {
+    BUFFER_DATA = 0,  //!< Buffer::Data
+    METADATA_DATA,    //!< PacketMetadata::Data
+    TAG_DATA,         //!< PacketTagList::TagData
+    CLIENT_COUNT
+  };
+
+  /** The statistics of a client of the pool. */
+  struct Statistics
+  {
+    uint64_t allocations;  //!< The number of blocks allocated.
+    uint64_t reused;       //!< The number of allocations served by a free list.
+    uint64_t releases;     //!< The number of blocks released.
+    uint64_t recycled;     //!< The number of released blocks kept in a free list.
+  };
+
+  /**
+   * Allocate a block.
+   * \param client The user of the block.
+   * \param size The requested size in bytes.
+   * \param [out] capacity The usable size of the block, at least \p size.
+   * \return The block.
+   */
+  static void * Allocate (Client client, uint32_t size, uint32_t &capacity);
+  /**
+   * Release a block.
+   * \param client The user of the block.
+   * \param block The block.
+   * \param size The requested size or the capacity of the block.
+   */
+  static void Deallocate (Client client, void *block, uint32_t size);
+  /**
+   * Enable or disable the recycling of the blocks, e.g., to benchmark the
+   * pool or to track the packets with a memory checker.
+   * \param enabled Whether the released blocks are kept in the free lists.
+   */
+  static void SetEnabled (bool enabled);
+  /**
+   * \param client The user of the pool.
+   * \return The statistics of the client in the calling thread.
+   */
+  static Statistics GetStatistics (Client client);
+  /**
+   * \return The number of bytes held by the free lists of the calling thread.
+   */
+  static uint64_t GetCachedBytes (void);
+  /** Reset the statistics of the calling thread. */
+  static void ResetStatistics (void);
+};
+
+} // namespace ns3
+
+#endif /* PACKET_MEMORY_POOL_H */
@@ -18,11 +18,13 @@
  * Author: Mathieu Lacage <mathieu.lacage@sophia.inria.fr>
  */
 #include <utility>
+#include <algorithm>
 #include <list>
 #include "ns3/assert.h"
 #include "ns3/fatal-error.h"
 #include "ns3/log.h"
 #include "packet-metadata.h"
+#include "packet-memory-pool.h"
 #include "buffer.h"
 #include "header.h"
 #include "trailer.h"
@@ -34,19 +36,7 @@ NS_LOG_COMPONENT_DEFINE ("PacketMetadata");
 bool PacketMetadata::m_enable = false;
 bool PacketMetadata::m_enableChecking = false;
 bool PacketMetadata::m_metadataSkipped = false;
-uint32_t PacketMetadata::m_maxSize = 0;
 uint16_t PacketMetadata::m_chunkUid = 0;
-PacketMetadata::DataFreeList PacketMetadata::m_freeList;
-
-PacketMetadata::DataFreeList::~DataFreeList ()
-{
-  NS_LOG_FUNCTION (this);
-  for (iterator i = begin (); i != end (); i++)
-    {
-      PacketMetadata::Deallocate (*i);
-    }
-  PacketMetadata::m_enable = false;
-}
 
 void 
 PacketMetadata::Enable (void)
@@ -570,48 +560,15 @@ struct PacketMetadata::Data *
 PacketMetadata::Create (uint32_t size)
 {
   NS_LOG_FUNCTION (size);
-  NS_LOG_LOGIC ("create size="<<size<<", max="<<m_maxSize);
-  if (size > m_maxSize)
-    {
-      m_maxSize = size;
-    }
-  while (!m_freeList.empty ()) 
-    {
-      struct PacketMetadata::Data *data = m_freeList.back ();
-      m_freeList.pop_back ();
-      if (data->m_size >= size) 
-        {
-          NS_LOG_LOGIC ("create found size="<<data->m_size);
-          data->m_count = 1;
-          return data;
-        }
-      NS_LOG_LOGIC ("create dealloc size="<<data->m_size);
-      PacketMetadata::Deallocate (data);
-    }
-  NS_LOG_LOGIC ("create alloc size="<<m_maxSize);
-  return PacketMetadata::Allocate (m_maxSize);
+  return PacketMetadata::Allocate (size);
 }
 
 void
 PacketMetadata::Recycle (struct PacketMetadata::Data *data)
 {
   NS_LOG_FUNCTION (data);
-  if (!m_enable)
-    {
-      PacketMetadata::Deallocate (data);
-      return;
-    } 
-  NS_LOG_LOGIC ("recycle size="<<data->m_size<<", list="<<m_freeList.size ());
   NS_ASSERT (data->m_count == 0);
-  if (m_freeList.size () > 1000 ||
-      data->m_size < m_maxSize) 
-    {
-      PacketMetadata::Deallocate (data);
-    } 
-  else 
-    {
-      m_freeList.push_back (data);
-    }
+  PacketMetadata::Deallocate (data);
 }
 
 struct PacketMetadata::Data *
@@ -623,10 +580,13 @@ PacketMetadata::Allocate (uint32_t n)
     {
       n = PACKET_METADATA_DATA_M_DATA_SIZE;
     }
+  NS_ASSERT (n <= 0xffff);
   size += n - PACKET_METADATA_DATA_M_DATA_SIZE;
-  uint8_t *buf = new uint8_t [size];
+  uint32_t capacity;
+  void *buf = PacketMemoryPool::Allocate (PacketMemoryPool::METADATA_DATA, size, capacity);
   struct PacketMetadata::Data *data = (struct PacketMetadata::Data *)buf;
-  data->m_size = n;
+  /* the whole block is usable, within the range of the 16 bit offsets */
+  data->m_size = std::min<uint32_t> (capacity - sizeof (struct Data) + PACKET_METADATA_DATA_M_DATA_SIZE, 0xffff);
   data->m_count = 1;
   data->m_dirtyEnd = 0;
   return data;
@@ -635,8 +595,8 @@ void
 PacketMetadata::Deallocate (struct PacketMetadata::Data *data)
 {
   NS_LOG_FUNCTION (data);
-  uint8_t *buf = (uint8_t *)data;
-  delete [] buf;
+  PacketMemoryPool::Deallocate (PacketMemoryPool::METADATA_DATA, data,
+                                data->m_size + sizeof (struct Data) - PACKET_METADATA_DATA_M_DATA_SIZE);
 }
 
 
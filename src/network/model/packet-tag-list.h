@@ -228,6 +228,13 @@ private:
    */
   static
   TagData * CreateTagData (size_t dataSize);
+  /**
+   * Destroy a TagData struct and release its memory.
+   *
+   * \param [in] tag The TagData object.
+   */
+  static
+  void DeleteTagData (TagData * tag);
   
   /**
    * Typedef of method function pointer for copy-on-write operations
@@ -341,15 +348,13 @@ PacketTagList::RemoveAll (void)
         }
       if (prev != 0) 
         {
-          prev->~TagData ();
-          std::free (prev);
+          DeleteTagData (prev);
         }
       prev = cur;
     }
   if (prev != 0) 
     {
-      prev->~TagData ();
-      std::free (prev);
+      DeleteTagData (prev);
     }
   m_next = 0;
 }
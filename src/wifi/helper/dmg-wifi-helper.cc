@@ -22,6 +22,8 @@
 #include "ns3/propagation-loss-model.h"
 #include "ns3/propagation-delay-model.h"
 #include "ns3/dmg-wifi-phy.h"
+#include "ns3/dmg-wifi-channel.h"
+#include "ns3/mpi-interface.h"
 #include "ns3/dmg-wifi-mac.h"
 #include "ns3/names.h"
 #include "ns3/log.h"
@@ -200,6 +202,12 @@ DmgWifiHelper::Install (const DmgWifiPhyHelper &phyHelper,
       device->SetRemoteStationManager (manager);
       node->AddDevice (device);
       devices.Add (device);
+      /* Deliver the signals exchanged with the nodes of other MPI tasks */
+      Ptr<DmgWifiChannel> channel = DynamicCast<DmgWifiChannel> (phy->GetChannel ());
+      if (MpiInterface::IsEnabled () && (channel != 0))
+        {
+          channel->EnableRemoteDelivery (phy);
+        }
       NS_LOG_DEBUG ("node=" << node << ", mob=" << node->GetObject<MobilityModel> ());
     }
   return devices;
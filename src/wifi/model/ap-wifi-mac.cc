@@ -1439,13 +1439,13 @@ ApWifiMac::DeaggregateAmsduAndForward (Ptr<Packet> aggregatedPacket, const WifiM
 {
   NS_LOG_FUNCTION (this << aggregatedPacket << hdr);
   MsduAggregator::DeaggregatedMsdus packets = MsduAggregator::Deaggregate (aggregatedPacket);
+  MsduAggregator::DeaggregatedMsdus local;
   for (MsduAggregator::DeaggregatedMsdusCI i = packets.begin ();
        i != packets.end (); ++i)
     {
       if ((*i).second.GetDestinationAddr () == GetAddress ())
         {
-          ForwardUp ((*i).first, (*i).second.GetSourceAddr (),
-                     (*i).second.GetDestinationAddr ());
+          local.push_back (*i);
         }
       else
         {
@@ -1455,6 +1455,7 @@ ApWifiMac::DeaggregateAmsduAndForward (Ptr<Packet> aggregatedPacket, const WifiM
           ForwardDown ((*i).first, from, to, hdr->GetQosTid ());
         }
     }
+  ForwardUpBurst (local);
 }
 
 void
@@ -24,6 +24,7 @@
 #include "mgt-headers.h"
 #include "wifi-mac-queue.h"
 #include "mac-tx-middle.h"
+#include <cstring>
 
 namespace ns3 {
 
@@ -37,6 +38,30 @@ BlockAckManager::Item::Item (Ptr<const Packet> packet, const WifiMacHeader &hdr,
   NS_LOG_FUNCTION (this << packet << hdr << tStamp);
 }
 
+BlockAckManager::TxWindow::TxWindow ()
+{
+  std::memset (retryBitmap, 0, sizeof (retryBitmap));
+}
+
+bool
+BlockAckManager::TxWindow::IsRetry (uint16_t seq) const
+{
+  return ((retryBitmap[seq / 64] >> (seq % 64)) & 1) == 1;
+}
+
+void
+BlockAckManager::TxWindow::SetRetry (uint16_t seq, bool retry)
+{
+  if (retry)
+    {
+      retryBitmap[seq / 64] |= (uint64_t (1) << (seq % 64));
+    }
+  else
+    {
+      retryBitmap[seq / 64] &= ~(uint64_t (1) << (seq % 64));
+    }
+}
+
 Bar::Bar ()
 {
   NS_LOG_FUNCTION (this);
@@ -74,24 +99,19 @@ BlockAckManager::~BlockAckManager ()
   NS_LOG_FUNCTION (this);
   m_queue = 0;
   m_agreements.clear ();
-  m_retryPackets.clear ();
 }
 
 void
 BlockAckManager::CopyAgreements (Mac48Address recipient, Ptr<BlockAckManager> manager)
 {
   NS_LOG_FUNCTION (this << recipient << manager);
-  std::pair<Mac48Address, uint8_t> key;
-  std::pair<OriginatorBlockAckAgreement, PacketQueue> value;
-  OriginatorBlockAckAgreement agreement;  /* The existing agreement */
   for (AgreementsI iter = m_agreements.begin (); iter != m_agreements.end (); iter++)
     {
-      key = iter->first;
-      value = iter->second;
+      const std::pair<Mac48Address, uint8_t> &key = iter->first;
       /* Check if there is already an existing agreement */
       if (!ExistsAgreement (recipient, key.second))
         {
-          agreement = value.first;
+          const OriginatorBlockAckAgreement &agreement = iter->second.first;  /* The existing agreement */
           OriginatorBlockAckAgreement clonedAgreement (recipient, key.second);
           clonedAgreement.SetStartingSequence (agreement.GetStartingSequence ());
           clonedAgreement.SetBufferSize (agreement.GetBufferSize ());
@@ -108,13 +128,72 @@ BlockAckManager::CopyAgreements (Mac48Address recipient, Ptr<BlockAckManager> ma
               clonedAgreement.SetDelayedBlockAck ();
             }
           clonedAgreement.SetState (agreement.GetState ());
-          std::pair<OriginatorBlockAckAgreement, PacketQueue> clonedValue (clonedAgreement, value.second);
+          /* The clone starts without pending retransmissions */
+          TxWindow window;
+          window.packets = iter->second.second.packets;
+          std::pair<OriginatorBlockAckAgreement, TxWindow> clonedValue (clonedAgreement, window);
           manager->m_agreements.insert (std::make_pair (key, clonedValue));
           manager->m_blockPackets (recipient, key.second);
         }
     }
 }
 
+void
+BlockAckManager::TransferAgreements (Mac48Address recipient, Ptr<BlockAckManager> manager)
+{
+  NS_LOG_FUNCTION (this << recipient << manager);
+  AgreementsI it = m_agreements.begin ();
+  while (it != m_agreements.end ())
+    {
+      AgreementsI current = it++;
+      if (current->first.first != recipient)
+        {
+          continue;
+        }
+      uint8_t tid = current->first.second;
+      OriginatorBlockAckAgreement &agreement = current->second.first;
+      agreement.m_inactivityEvent.Cancel ();
+      if (agreement.IsEstablished ())
+        {
+          /* Drop whatever the target kept from an earlier session with the same recipient */
+          AgreementsI stale = manager->m_agreements.find (current->first);
+          if (stale != manager->m_agreements.end ())
+            {
+              stale->second.first.m_inactivityEvent.Cancel ();
+              manager->DestroyAgreement (recipient, tid);
+            }
+          std::pair<OriginatorBlockAckAgreement, TxWindow> value (agreement, TxWindow ());
+          AgreementsI target = manager->m_agreements.insert (std::make_pair (current->first, value)).first;
+          /* Unacknowledged MPDUs are retransmitted in the new band, they keep their sequence numbers */
+          TxWindow &window = target->second.second;
+          window.packets.splice (window.packets.end (), current->second.second.packets);
+          for (PacketQueueI item = window.packets.begin (); item != window.packets.end (); item++)
+            {
+              manager->InsertInRetryQueue (window, item);
+            }
+          if (agreement.GetTimeout () != 0)
+            {
+              Time timeout = MicroSeconds (1024 * agreement.GetTimeout ());
+              target->second.first.m_inactivityEvent = Simulator::Schedule (timeout,
+                                                                            &BlockAckManager::InactivityTimeout,
+                                                                            PeekPointer (manager),
+                                                                            recipient, tid);
+            }
+          manager->m_unblockPackets (recipient, tid);
+          NS_LOG_DEBUG ("Transferred agreement with " << recipient << " TID=" << +tid
+                        << " and " << window.packets.size () << " unacknowledged MPDUs");
+        }
+      else
+        {
+          /* A pending negotiation cannot complete once the band changed */
+          current->second.second.retryPackets.clear ();
+          current->second.second.packets.clear ();
+          m_unblockPackets (recipient, tid);
+        }
+      DestroyAgreement (recipient, tid);
+    }
+}
+
 bool
 BlockAckManager::ExistsAgreement (Mac48Address recipient, uint8_t tid) const
 {
@@ -171,8 +250,7 @@ BlockAckManager::CreateAgreement (const MgtAddBaRequestHeader *reqHdr, Mac48Addr
       agreement.SetDelayedBlockAck ();
     }
   agreement.SetState (OriginatorBlockAckAgreement::PENDING);
-  PacketQueue queue;
-  std::pair<OriginatorBlockAckAgreement, PacketQueue> value (agreement, queue);
+  std::pair<OriginatorBlockAckAgreement, TxWindow> value (agreement, TxWindow ());
   m_agreements.insert (std::make_pair (key, value));
   m_blockPackets (recipient, reqHdr->GetTid ());
 }
@@ -184,17 +262,6 @@ BlockAckManager::DestroyAgreement (Mac48Address recipient, uint8_t tid)
   AgreementsI it = m_agreements.find (std::make_pair (recipient, tid));
   if (it != m_agreements.end ())
     {
-      for (std::list<PacketQueueI>::const_iterator i = m_retryPackets.begin (); i != m_retryPackets.end (); )
-        {
-          if ((*i)->hdr.GetAddr1 () == recipient && (*i)->hdr.GetQosTid () == tid)
-            {
-              i = m_retryPackets.erase (i);
-            }
-          else
-            {
-              i++;
-            }
-        }
       m_agreements.erase (it);
       //remove scheduled bar
       for (std::list<Bar>::const_iterator i = m_bars.begin (); i != m_bars.end (); )
@@ -256,23 +323,20 @@ BlockAckManager::StorePacket (Ptr<const Packet> packet, const WifiMacHeader &hdr
   Item item (packet, hdr, tStamp);
   AgreementsI it = m_agreements.find (std::make_pair (recipient, tid));
   NS_ASSERT (it != m_agreements.end ());
-  PacketQueueI queueIt = it->second.second.begin ();
-  for (; queueIt != it->second.second.end (); )
+  PacketQueue &packets = it->second.second.packets;
+  /* Packets are mostly stored in sequence number order, so look for the position from the tail */
+  PacketQueueI queueIt = packets.end ();
+  while (queueIt != packets.begin ())
     {
-      if (((hdr.GetSequenceNumber () - queueIt->hdr.GetSequenceNumber () + 4096) % 4096) > 2047)
+      PacketQueueI previous = queueIt;
+      previous--;
+      if (((hdr.GetSequenceNumber () - previous->hdr.GetSequenceNumber () + 4096) % 4096) <= 2047)
         {
-          queueIt = it->second.second.insert (queueIt, item);
           break;
         }
-      else
-        {
-          queueIt++;
-        }
-    }
-  if (queueIt == it->second.second.end ())
-    {
-      it->second.second.push_back (item);
+      queueIt = previous;
     }
+  packets.insert (queueIt, item);
 }
 
 void
@@ -292,31 +356,30 @@ BlockAckManager::GetNextPacket (WifiMacHeader &hdr, bool removePacket)
   uint8_t tid;
   Mac48Address recipient;
   CleanupBuffers ();
-  if (!m_retryPackets.empty ())
+  for (AgreementsI agreement = m_agreements.begin (); agreement != m_agreements.end (); agreement++)
     {
-      NS_LOG_DEBUG ("Retry buffer size is " << m_retryPackets.size ());
-      std::list<PacketQueueI>::const_iterator it = m_retryPackets.begin ();
-      while (it != m_retryPackets.end ())
+      TxWindow &window = agreement->second.second;
+      if (window.retryPackets.empty ())
         {
-          if ((*it)->hdr.IsQosData ())
-            {
-              tid = (*it)->hdr.GetQosTid ();
-            }
-          else
+          continue;
+        }
+      NS_LOG_DEBUG ("Retry buffer size is " << window.retryPackets.size ());
+      RetryQueueI it = window.retryPackets.begin ();
+      while (it != window.retryPackets.end ())
+        {
+          if (!(*it)->hdr.IsQosData ())
             {
               NS_FATAL_ERROR ("Packet in blockAck manager retry queue is not Qos Data");
             }
-          recipient = (*it)->hdr.GetAddr1 ();
-          AgreementsI agreement = m_agreements.find (std::make_pair (recipient, tid));
-          NS_ASSERT (agreement != m_agreements.end ());
           if (removePacket)
             {
               if (QosUtilsIsOldPacket (agreement->second.first.GetStartingSequence (),(*it)->hdr.GetSequenceNumber ()))
                 {
                   //Standard says the originator should not send a packet with seqnum < winstart
                   NS_LOG_DEBUG ("The Retry packet have sequence number < WinStartO --> Discard " << (*it)->hdr.GetSequenceNumber () << " " << agreement->second.first.GetStartingSequence ());
-                  agreement->second.second.erase ((*it));
-                  it = m_retryPackets.erase (it);
+                  PacketQueueI item = *it;
+                  it = EraseFromRetryQueue (window, it);
+                  window.packets.erase (item);
                   continue;
                 }
               else if ((*it)->hdr.GetSequenceNumber () > (agreement->second.first.GetStartingSequence () + 63) % 4096)
@@ -327,15 +390,9 @@ BlockAckManager::GetNextPacket (WifiMacHeader &hdr, bool removePacket)
           packet = (*it)->packet->Copy ();
           hdr = (*it)->hdr;
           hdr.SetRetry ();
-          if (hdr.IsQosData ())
-            {
-              tid = hdr.GetQosTid ();
-            }
-          else
-            {
-              NS_FATAL_ERROR ("Packet in blockAck manager retry queue is not Qos Data");
-            }
+          tid = hdr.GetQosTid ();
           recipient = hdr.GetAddr1 ();
+          bool normalAck = false;
           if (!agreement->second.first.IsHtSupported ()
               && (ExistsAgreementInState (recipient, tid, OriginatorBlockAckAgreement::ESTABLISHED)
                   || SwitchToBlockAckIfNeeded (recipient, tid, hdr.GetSequenceNumber ())))
@@ -352,19 +409,20 @@ BlockAckManager::GetNextPacket (WifiMacHeader &hdr, bool removePacket)
                * the use of Block Ack.
                */
               hdr.SetQosAckPolicy (WifiMacHeader::NORMAL_ACK);
-              if (removePacket)
-                {
-                  AgreementsI i = m_agreements.find (std::make_pair (recipient, tid));
-                  i->second.second.erase (*it);
-                }
+              normalAck = true;
             }
           if (removePacket)
             {
               NS_LOG_INFO ("Retry packet seq = " << hdr.GetSequenceNumber ());
-              it = m_retryPackets.erase (it);
-              NS_LOG_DEBUG ("Removed one packet, retry buffer size = " << m_retryPackets.size ());
+              PacketQueueI item = *it;
+              EraseFromRetryQueue (window, it);
+              if (normalAck)
+                {
+                  window.packets.erase (item);
+                }
+              NS_LOG_DEBUG ("Removed one packet, retry buffer size = " << window.retryPackets.size ());
             }
-          break;
+          return packet;
         }
     }
   return packet;
@@ -378,54 +436,51 @@ BlockAckManager::PeekNextPacketByTidAndAddress (WifiMacHeader &hdr, Mac48Address
   CleanupBuffers ();
   AgreementsI agreement = m_agreements.find (std::make_pair (recipient, tid));
   NS_ASSERT (agreement != m_agreements.end ());
-  std::list<PacketQueueI>::const_iterator it = m_retryPackets.begin ();
-  for (; it != m_retryPackets.end (); it++)
+  TxWindow &window = agreement->second.second;
+  RetryQueueI it = window.retryPackets.begin ();
+  while (it != window.retryPackets.end ())
     {
       if (!(*it)->hdr.IsQosData ())
         {
           NS_FATAL_ERROR ("Packet in blockAck manager retry queue is not Qos Data");
         }
-      if ((*it)->hdr.GetAddr1 () == recipient && (*it)->hdr.GetQosTid () == tid)
+      if (QosUtilsIsOldPacket (agreement->second.first.GetStartingSequence (),(*it)->hdr.GetSequenceNumber ()))
         {
-          if (QosUtilsIsOldPacket (agreement->second.first.GetStartingSequence (),(*it)->hdr.GetSequenceNumber ()))
-            {
-              //standard says the originator should not send a packet with seqnum < winstart
-              NS_LOG_DEBUG ("The Retry packet have sequence number < WinStartO --> Discard " << (*it)->hdr.GetSequenceNumber () << " " << agreement->second.first.GetStartingSequence ());
-              agreement->second.second.erase ((*it));
-              it = m_retryPackets.erase (it);
-              it--;
-              continue;
-            }
-          else if ((*it)->hdr.GetSequenceNumber () > (agreement->second.first.GetStartingSequence () + 63) % 4096)
-            {
-              agreement->second.first.SetStartingSequence ((*it)->hdr.GetSequenceNumber ());
-            }
-          packet = (*it)->packet->Copy ();
-          hdr = (*it)->hdr;
-          hdr.SetRetry ();
-          *tstamp = (*it)->timestamp;
-          NS_LOG_INFO ("Retry packet seq = " << hdr.GetSequenceNumber ());
-          Mac48Address recipient = hdr.GetAddr1 ();
-          if (!agreement->second.first.IsHtSupported ()
-              && (ExistsAgreementInState (recipient, tid, OriginatorBlockAckAgreement::ESTABLISHED)
-                  || SwitchToBlockAckIfNeeded (recipient, tid, hdr.GetSequenceNumber ())))
-            {
-              hdr.SetQosAckPolicy (WifiMacHeader::BLOCK_ACK);
-            }
-          else
-            {
-              /* From section 9.10.3 in IEEE802.11e standard:
-               * In order to improve efficiency, originators using the Block Ack facility
-               * may send MPDU frames with the Ack Policy subfield in QoS control frames
-               * set to Normal Ack if only a few MPDUs are available for transmission.[...]
-               * When there are sufficient number of MPDUs, the originator may switch back to
-               * the use of Block Ack.
-               */
-              hdr.SetQosAckPolicy (WifiMacHeader::NORMAL_ACK);
-            }
-          NS_LOG_DEBUG ("Peeked one packet from retry buffer size = " << m_retryPackets.size () );
-          return packet;
+          //standard says the originator should not send a packet with seqnum < winstart
+          NS_LOG_DEBUG ("The Retry packet have sequence number < WinStartO --> Discard " << (*it)->hdr.GetSequenceNumber () << " " << agreement->second.first.GetStartingSequence ());
+          PacketQueueI item = *it;
+          it = EraseFromRetryQueue (window, it);
+          window.packets.erase (item);
+          continue;
+        }
+      else if ((*it)->hdr.GetSequenceNumber () > (agreement->second.first.GetStartingSequence () + 63) % 4096)
+        {
+          agreement->second.first.SetStartingSequence ((*it)->hdr.GetSequenceNumber ());
         }
+      packet = (*it)->packet->Copy ();
+      hdr = (*it)->hdr;
+      hdr.SetRetry ();
+      *tstamp = (*it)->timestamp;
+      NS_LOG_INFO ("Retry packet seq = " << hdr.GetSequenceNumber ());
+      if (!agreement->second.first.IsHtSupported ()
+          && (ExistsAgreementInState (recipient, tid, OriginatorBlockAckAgreement::ESTABLISHED)
+              || SwitchToBlockAckIfNeeded (recipient, tid, hdr.GetSequenceNumber ())))
+        {
+          hdr.SetQosAckPolicy (WifiMacHeader::BLOCK_ACK);
+        }
+      else
+        {
+          /* From section 9.10.3 in IEEE802.11e standard:
+           * In order to improve efficiency, originators using the Block Ack facility
+           * may send MPDU frames with the Ack Policy subfield in QoS control frames
+           * set to Normal Ack if only a few MPDUs are available for transmission.[...]
+           * When there are sufficient number of MPDUs, the originator may switch back to
+           * the use of Block Ack.
+           */
+          hdr.SetQosAckPolicy (WifiMacHeader::NORMAL_ACK);
+        }
+      NS_LOG_DEBUG ("Peeked one packet from retry buffer size = " << window.retryPackets.size () );
+      return packet;
     }
   return packet;
 }
@@ -433,21 +488,20 @@ BlockAckManager::PeekNextPacketByTidAndAddress (WifiMacHeader &hdr, Mac48Address
 bool
 BlockAckManager::RemovePacket (uint8_t tid, Mac48Address recipient, uint16_t seqnumber)
 {
-
-  std::list<PacketQueueI>::const_iterator it = m_retryPackets.begin ();
-  for (; it != m_retryPackets.end (); it++)
+  AgreementsI agreement = m_agreements.find (std::make_pair (recipient, tid));
+  if (agreement == m_agreements.end () || !agreement->second.second.IsRetry (seqnumber))
     {
-      if (!(*it)->hdr.IsQosData ())
-        {
-          NS_FATAL_ERROR ("Packet in blockAck manager retry queue is not Qos Data");
-        }
-      if ((*it)->hdr.GetAddr1 () == recipient && (*it)->hdr.GetQosTid () == tid && (*it)->hdr.GetSequenceNumber () == seqnumber)
+      return false;
+    }
+  TxWindow &window = agreement->second.second;
+  for (RetryQueueI it = window.retryPackets.begin (); it != window.retryPackets.end (); it++)
+    {
+      if ((*it)->hdr.GetSequenceNumber () == seqnumber)
         {
-          WifiMacHeader hdr = (*it)->hdr;
-          AgreementsI i = m_agreements.find (std::make_pair (recipient, tid));
-          i->second.second.erase ((*it));
-          m_retryPackets.erase (it);
-          NS_LOG_DEBUG ("Removed Packet from retry queue = " << hdr.GetSequenceNumber () << " " << +tid << " " << recipient << " Buffer Size = " << m_retryPackets.size ());
+          PacketQueueI item = *it;
+          EraseFromRetryQueue (window, it);
+          window.packets.erase (item);
+          NS_LOG_DEBUG ("Removed Packet from retry queue = " << seqnumber << " " << +tid << " " << recipient << " Buffer Size = " << window.retryPackets.size ());
           return true;
         }
     }
@@ -471,7 +525,18 @@ bool
 BlockAckManager::HasPackets (void) const
 {
   NS_LOG_FUNCTION (this);
-  return (m_retryPackets.size () > 0 || m_bars.size () > 0);
+  if (m_bars.size () > 0)
+    {
+      return true;
+    }
+  for (AgreementsCI it = m_agreements.begin (); it != m_agreements.end (); it++)
+    {
+      if (!it->second.second.retryPackets.empty ())
+        {
+          return true;
+        }
+    }
+  return false;
 }
 
 uint32_t
@@ -484,13 +549,14 @@ BlockAckManager::GetNBufferedPackets (Mac48Address recipient, uint8_t tid) const
       return 0;
     }
   uint32_t nPackets = 0;
-  PacketQueueCI queueIt = (*it).second.second.begin ();
-  while (queueIt != (*it).second.second.end ())
+  const PacketQueue &packets = (*it).second.second.packets;
+  PacketQueueCI queueIt = packets.begin ();
+  while (queueIt != packets.end ())
     {
       uint16_t currentSeq = (*queueIt).hdr.GetSequenceNumber ();
       nPackets++;
       /* a fragmented packet must be counted as one packet */
-      while (queueIt != (*it).second.second.end () && (*queueIt).hdr.GetSequenceNumber () == currentSeq)
+      while (queueIt != packets.end () && (*queueIt).hdr.GetSequenceNumber () == currentSeq)
         {
           queueIt++;
         }
@@ -503,28 +569,17 @@ BlockAckManager::GetNRetryNeededPackets (Mac48Address recipient, uint8_t tid) co
 {
   NS_LOG_FUNCTION (this << recipient << +tid);
   uint32_t nPackets = 0;
-  uint16_t currentSeq = 0;
-  if (ExistsAgreement (recipient, tid))
+  AgreementsCI agreement = m_agreements.find (std::make_pair (recipient, tid));
+  if (agreement != m_agreements.end ())
     {
-      std::list<PacketQueueI>::const_iterator it = m_retryPackets.begin ();
-      while (it != m_retryPackets.end ())
+      const RetryQueue &retryPackets = agreement->second.second.retryPackets;
+      RetryQueue::const_iterator it = retryPackets.begin ();
+      while (it != retryPackets.end ())
         {
-          if (!(*it)->hdr.IsQosData ())
-            {
-              NS_FATAL_ERROR ("Packet in blockAck manager retry queue is not Qos Data");
-            }
-          if ((*it)->hdr.GetAddr1 () == recipient && (*it)->hdr.GetQosTid () == tid)
-            {
-              currentSeq = (*it)->hdr.GetSequenceNumber ();
-              nPackets++;
-              /* a fragmented packet must be counted as one packet */
-              while (it != m_retryPackets.end () && (*it)->hdr.GetSequenceNumber () == currentSeq)
-                {
-                  it++;
-                }
-            }
-          //go to next packet
-          else
+          uint16_t currentSeq = (*it)->hdr.GetSequenceNumber ();
+          nPackets++;
+          /* a fragmented packet must be counted as one packet */
+          while (it != retryPackets.end () && (*it)->hdr.GetSequenceNumber () == currentSeq)
             {
               it++;
             }
@@ -550,21 +605,9 @@ BlockAckManager::SetWifiRemoteStationManager (const Ptr<WifiRemoteStationManager
 bool
 BlockAckManager::AlreadyExists (uint16_t currentSeq, Mac48Address recipient, uint8_t tid) const
 {
-  std::list<PacketQueueI>::const_iterator it = m_retryPackets.begin ();
-  while (it != m_retryPackets.end ())
-    {
-      NS_LOG_FUNCTION (this << (*it)->hdr.GetType ());
-      if (!(*it)->hdr.IsQosData ())
-        {
-          NS_FATAL_ERROR ("Packet in blockAck manager retry queue is not Qos Data");
-        }
-      if ((*it)->hdr.GetAddr1 () == recipient && (*it)->hdr.GetQosTid () == tid && currentSeq == (*it)->hdr.GetSequenceNumber ())
-        {
-          return true;
-        }
-      it++;
-    }
-  return false;
+  NS_LOG_FUNCTION (this << currentSeq << recipient << +tid);
+  AgreementsCI agreement = m_agreements.find (std::make_pair (recipient, tid));
+  return (agreement != m_agreements.end () && agreement->second.second.IsRetry (currentSeq));
 }
 
 void
@@ -581,7 +624,8 @@ BlockAckManager::NotifyGotBlockAck (const CtrlBAckResponseHeader *blockAck, Mac4
           uint8_t nSuccessfulMpdus = 0;
           uint8_t nFailedMpdus = 0;
           AgreementsI it = m_agreements.find (std::make_pair (recipient, tid));
-          PacketQueueI queueEnd = it->second.second.end ();
+          TxWindow &window = it->second.second;
+          PacketQueueI queueEnd = window.packets.end ();
 
           if (it->second.first.m_inactivityEvent.IsRunning ())
             {
@@ -597,14 +641,14 @@ BlockAckManager::NotifyGotBlockAck (const CtrlBAckResponseHeader *blockAck, Mac4
             }
           if (blockAck->IsBasic ())
             {
-              for (PacketQueueI queueIt = it->second.second.begin (); queueIt != queueEnd; )
+              for (PacketQueueI queueIt = window.packets.begin (); queueIt != queueEnd; )
                 {
                   if (blockAck->IsFragmentReceived ((*queueIt).hdr.GetSequenceNumber (),
                                                     (*queueIt).hdr.GetFragmentNumber ()))
                     {
                       nSuccessfulMpdus++;
-                      RemoveFromRetryQueue (recipient, tid, (*queueIt).hdr.GetSequenceNumber ());
-                      queueIt = it->second.second.erase (queueIt);
+                      RemoveFromRetryQueue (window, (*queueIt).hdr.GetSequenceNumber ());
+                      queueIt = window.packets.erase (queueIt);
                     }
                   else
                     {
@@ -615,9 +659,9 @@ BlockAckManager::NotifyGotBlockAck (const CtrlBAckResponseHeader *blockAck, Mac4
                           (*it).second.first.SetStartingSequence (sequenceFirstLost);
                         }
                       nFailedMpdus++;
-                      if (!AlreadyExists ((*queueIt).hdr.GetSequenceNumber (),recipient,tid))
+                      if (!window.IsRetry ((*queueIt).hdr.GetSequenceNumber ()))
                         {
-                          InsertInRetryQueue (queueIt);
+                          InsertInRetryQueue (window, queueIt);
                         }
                       queueIt++;
                     }
@@ -625,10 +669,15 @@ BlockAckManager::NotifyGotBlockAck (const CtrlBAckResponseHeader *blockAck, Mac4
             }
           else if (blockAck->IsCompressed ())
             {
-              for (PacketQueueI queueIt = it->second.second.begin (); queueIt != queueEnd; )
+              /* The compressed bitmap is a single word, each packet is checked with a shift
+               * from its offset to the starting sequence number of the block ack */
+              uint64_t bitmap = blockAck->GetCompressedBitmap ();
+              uint16_t startingSeq = blockAck->GetStartingSequence ();
+              for (PacketQueueI queueIt = window.packets.begin (); queueIt != queueEnd; )
                 {
                   uint16_t currentSeq = (*queueIt).hdr.GetSequenceNumber ();
-                  if (blockAck->IsPacketReceived (currentSeq))
+                  uint16_t offset = (currentSeq - startingSeq + 4096) % 4096;
+                  if (offset < 64 && ((bitmap >> offset) & 1) == 1)
                     {
                       while (queueIt != queueEnd
                              && (*queueIt).hdr.GetSequenceNumber () == currentSeq)
@@ -638,8 +687,8 @@ BlockAckManager::NotifyGotBlockAck (const CtrlBAckResponseHeader *blockAck, Mac4
                             {
                               m_txOkCallback ((*queueIt).hdr);
                             }
-                          RemoveFromRetryQueue (recipient, tid, currentSeq);
-                          queueIt = it->second.second.erase (queueIt);
+                          RemoveFromRetryQueue (window, currentSeq);
+                          queueIt = window.packets.erase (queueIt);
                         }
                     }
                   else
@@ -655,9 +704,9 @@ BlockAckManager::NotifyGotBlockAck (const CtrlBAckResponseHeader *blockAck, Mac4
                         {
                           m_txFailedCallback ((*queueIt).hdr);
                         }
-                      if (!AlreadyExists ((*queueIt).hdr.GetSequenceNumber (),recipient,tid))
+                      if (!window.IsRetry (currentSeq))
                         {
-                          InsertInRetryQueue (queueIt);
+                          InsertInRetryQueue (window, queueIt);
                         }
                       queueIt++;
                     }
@@ -699,7 +748,7 @@ BlockAckManager::ScheduleBlockAckReqIfNeeded (Mac48Address recipient, uint8_t ti
   NS_ASSERT (it != m_agreements.end ());
 
   if ((*it).second.first.IsBlockAckRequestNeeded ()
-      || (GetNRetryNeededPackets (recipient, tid) == 0
+      || ((*it).second.second.retryPackets.empty ()
           && m_queue->GetNPacketsByTidAndAddress (tid, WifiMacHeader::ADDR1, recipient) == 0))
     {
       OriginatorBlockAckAgreement &agreement = (*it).second.first;
@@ -813,7 +862,11 @@ bool BlockAckManager::NeedBarRetransmission (uint8_t tid, uint16_t seqNumber, Ma
 {
   //The standard says the BAR gets discarded when all MSDUs lifetime expires
   AgreementsI it = m_agreements.find (std::make_pair (recipient, tid));
-  NS_ASSERT (it != m_agreements.end ());
+  if (it == m_agreements.end ())
+    {
+      /* The agreement has been torn down or transferred to another band */
+      return false;
+    }
   CleanupBuffers ();
   if ((seqNumber + 63) < it->second.first.GetStartingSequence ())
     {
@@ -840,17 +893,19 @@ bool BlockAckManager::NeedBarRetransmission (uint8_t tid, uint16_t seqNumber, Ma
 }
 
 void
-BlockAckManager::RemoveFromRetryQueue (Mac48Address address, uint8_t tid, uint16_t seq)
+BlockAckManager::RemoveFromRetryQueue (TxWindow &window, uint16_t seq)
 {
   /* remove retry packet iterator if it's present in retry queue */
-  std::list<PacketQueueI>::const_iterator it = m_retryPackets.begin ();
-  while (it != m_retryPackets.end ())
+  if (!window.IsRetry (seq))
+    {
+      return;
+    }
+  RetryQueueI it = window.retryPackets.begin ();
+  while (it != window.retryPackets.end ())
     {
-      if ((*it)->hdr.GetAddr1 () == address
-          && (*it)->hdr.GetQosTid () == tid
-          && (*it)->hdr.GetSequenceNumber () == seq)
+      if ((*it)->hdr.GetSequenceNumber () == seq)
         {
-          it = m_retryPackets.erase (it);
+          it = EraseFromRetryQueue (window, it);
         }
       else
         {
@@ -859,19 +914,40 @@ BlockAckManager::RemoveFromRetryQueue (Mac48Address address, uint8_t tid, uint16
     }
 }
 
+BlockAckManager::RetryQueueI
+BlockAckManager::EraseFromRetryQueue (TxWindow &window, RetryQueueI it)
+{
+  uint16_t seq = (*it)->hdr.GetSequenceNumber ();
+  it = window.retryPackets.erase (it);
+  /* fragments of a packet share its sequence number and are adjacent in the retry queue */
+  bool fragmentLeft = (it != window.retryPackets.end () && (*it)->hdr.GetSequenceNumber () == seq);
+  if (!fragmentLeft && it != window.retryPackets.begin ())
+    {
+      RetryQueueI previous = it;
+      previous--;
+      fragmentLeft = ((*previous)->hdr.GetSequenceNumber () == seq);
+    }
+  if (!fragmentLeft)
+    {
+      window.SetRetry (seq, false);
+    }
+  return it;
+}
+
 void
 BlockAckManager::CleanupBuffers (void)
 {
   NS_LOG_FUNCTION (this);
   for (AgreementsI j = m_agreements.begin (); j != m_agreements.end (); j++)
     {
-      if (j->second.second.empty ())
+      TxWindow &window = j->second.second;
+      if (window.packets.empty ())
         {
           continue;
         }
       Time now = Simulator::Now ();
-      PacketQueueI end = j->second.second.begin ();
-      for (PacketQueueI i = j->second.second.begin (); i != j->second.second.end (); i++)
+      PacketQueueI end = window.packets.begin ();
+      for (PacketQueueI i = window.packets.begin (); i != window.packets.end (); i++)
         {
           if (i->timestamp + m_maxDelay > now)
             {
@@ -880,12 +956,10 @@ BlockAckManager::CleanupBuffers (void)
             }
           else
             {
-              RemoveFromRetryQueue (j->second.first.GetPeer (),
-                                    j->second.first.GetTid (),
-                                    i->hdr.GetSequenceNumber ());
+              RemoveFromRetryQueue (window, i->hdr.GetSequenceNumber ());
             }
         }
-      j->second.second.erase (j->second.second.begin (), end);
+      window.packets.erase (window.packets.begin (), end);
       j->second.first.SetStartingSequence (end->hdr.GetSequenceNumber ());
     }
 }
@@ -929,20 +1003,12 @@ uint16_t
 BlockAckManager::GetSeqNumOfNextRetryPacket (Mac48Address recipient, uint8_t tid) const
 {
   NS_LOG_FUNCTION (this << recipient << +tid);
-  std::list<PacketQueueI>::const_iterator it = m_retryPackets.begin ();
-  while (it != m_retryPackets.end ())
+  AgreementsCI agreement = m_agreements.find (std::make_pair (recipient, tid));
+  if (agreement == m_agreements.end () || agreement->second.second.retryPackets.empty ())
     {
-      if (!(*it)->hdr.IsQosData ())
-        {
-          NS_FATAL_ERROR ("Packet in blockAck manager retry queue is not Qos Data");
-        }
-      if ((*it)->hdr.GetAddr1 () == recipient && (*it)->hdr.GetQosTid () == tid)
-        {
-          return (*it)->hdr.GetSequenceNumber ();
-        }
-      it++;
+      return 4096;
     }
-  return 4096;
+  return agreement->second.second.retryPackets.front ()->hdr.GetSequenceNumber ();
 }
 
 void
@@ -958,32 +1024,24 @@ BlockAckManager::SetTxFailedCallback (TxFailed callback)
 }
 
 void
-BlockAckManager::InsertInRetryQueue (PacketQueueI item)
+BlockAckManager::InsertInRetryQueue (TxWindow &window, PacketQueueI item)
 {
-  NS_LOG_INFO ("Adding to retry queue " << (*item).hdr.GetSequenceNumber ());
-  if (m_retryPackets.size () == 0)
-    {
-      m_retryPackets.push_back (item);
-    }
-  else
+  uint16_t seq = item->hdr.GetSequenceNumber ();
+  NS_LOG_INFO ("Adding to retry queue " << seq);
+  /* Failed packets are mostly reported in sequence number order, so look for the position from the tail */
+  RetryQueueI it = window.retryPackets.end ();
+  while (it != window.retryPackets.begin ())
     {
-      for (std::list<PacketQueueI>::const_iterator it = m_retryPackets.begin (); it != m_retryPackets.end (); )
+      RetryQueueI previous = it;
+      previous--;
+      if (((seq - (*previous)->hdr.GetSequenceNumber () + 4096) % 4096) <= 2047)
         {
-          if (((item->hdr.GetSequenceNumber () - (*it)->hdr.GetSequenceNumber () + 4096) % 4096) > 2047)
-            {
-              it = m_retryPackets.insert (it, item);
-              break;
-            }
-          else
-            {
-              it++;
-              if (it == m_retryPackets.end ())
-                {
-                  m_retryPackets.push_back (item);
-                }
-            }
+          break;
         }
+      it = previous;
     }
+  window.retryPackets.insert (it, item);
+  window.SetRetry (seq, true);
 }
 
 } //namespace ns3
@@ -103,6 +103,15 @@ public:
    * <i>recipient</i> for tid <i>tid</i>.
    */
   void CopyAgreements (Mac48Address recipient, Ptr<BlockAckManager> manager);
+  /**
+   * \param recipient Address of peer station involved in block ack mechanism.
+   * \param manager The BlockAckManager of the technology taking over the session.
+   *
+   * Move the established block ack agreements with <i>recipient</i> to <i>manager</i>
+   * together with the MPDUs still waiting for an acknowledgment, which are scheduled
+   * for retransmission. The agreements are removed from this manager.
+   */
+  void TransferAgreements (Mac48Address recipient, Ptr<BlockAckManager> manager);
   /**
    * \param recipient Address of peer station involved in block ack mechanism.
    * \param tid Traffic ID.
@@ -427,21 +436,30 @@ private:
    * typedef for a const iterator for PacketQueue.
    */
   typedef std::list<Item>::const_iterator PacketQueueCI;
+  /**
+   * typedef for a list of iterators to the packets that need to be retransmitted.
+   */
+  typedef std::list<PacketQueueI> RetryQueue;
+  /**
+   * typedef for an iterator for RetryQueue.
+   */
+  typedef std::list<PacketQueueI>::iterator RetryQueueI;
+  struct TxWindow;
   /**
    * typedef for a map between MAC address and block ACK agreement.
    */
   typedef std::map<std::pair<Mac48Address, uint8_t>,
-                   std::pair<OriginatorBlockAckAgreement, PacketQueue> > Agreements;
+                   std::pair<OriginatorBlockAckAgreement, TxWindow> > Agreements;
   /**
    * typedef for an iterator for Agreements.
    */
   typedef std::map<std::pair<Mac48Address, uint8_t>,
-                   std::pair<OriginatorBlockAckAgreement, PacketQueue> >::iterator AgreementsI;
+                   std::pair<OriginatorBlockAckAgreement, TxWindow> >::iterator AgreementsI;
   /**
    * typedef for a const iterator for Agreements.
    */
   typedef std::map<std::pair<Mac48Address, uint8_t>,
-                   std::pair<OriginatorBlockAckAgreement, PacketQueue> >::const_iterator AgreementsCI;
+                   std::pair<OriginatorBlockAckAgreement, TxWindow> >::const_iterator AgreementsCI;
 
   /**
    * A struct for packet, Wifi header, and timestamp.
@@ -464,22 +482,54 @@ private:
     Time timestamp; ///< timestamp
   };
   /**
+   * The packets sent under a block ack agreement and not acknowledged yet, and
+   * the subset of them that need to be retransmitted. The sequence numbers of
+   * the packets in the retransmission queue are also flagged in a bitmap
+   * covering the whole sequence number space, so that checking whether a
+   * packet needs a retransmission does not walk the retransmission queue.
+   */
+  struct TxWindow
+  {
+    TxWindow ();
+    /**
+     * \param seq the sequence number
+     * \return true if a packet with the given sequence number is in the retransmission queue
+     */
+    bool IsRetry (uint16_t seq) const;
+    /**
+     * \param seq the sequence number
+     * \param retry true if a packet with the given sequence number is in the retransmission queue
+     */
+    void SetRetry (uint16_t seq, bool retry);
+
+    PacketQueue packets; ///< packets waiting for an acknowledgment, in sequence number order
+    RetryQueue retryPackets; ///< packets that need a retransmission, in sequence number order
+    uint64_t retryBitmap[64]; ///< one bit per sequence number of the packets in retryPackets
+  };
+  /**
+   * \param window the window of the agreement the packet belongs to
    * \param item
    *
    * Insert item in retransmission queue.
    * This method ensures packets are retransmitted in the correct order.
    */
-  void InsertInRetryQueue (PacketQueueI item);
-
+  void InsertInRetryQueue (TxWindow &window, PacketQueueI item);
   /**
    * Remove items from retransmission queue.
    * This method should be called when packets are acknowledged.
    *
-   * \param address recipient mac address of the packet to be removed
-   * \param tid Traffic ID of the packet to be removed
+   * \param window the window of the agreement the packet belongs to
    * \param seq sequence number of the packet to be removed
    */
-  void RemoveFromRetryQueue (Mac48Address address, uint8_t tid, uint16_t seq);
+  void RemoveFromRetryQueue (TxWindow &window, uint16_t seq);
+  /**
+   * Remove an item from the retransmission queue.
+   *
+   * \param window the window of the agreement the packet belongs to
+   * \param it the item to remove
+   * \return an iterator to the next item of the retransmission queue
+   */
+  RetryQueueI EraseFromRetryQueue (TxWindow &window, RetryQueueI it);
 
   /**
    * This data structure contains, for each block ack agreement (recipient, tid), a set of packets
@@ -489,12 +539,6 @@ private:
    */
   Agreements m_agreements;
 
-  /**
-   * This list contains all iterators to stored packets that need to be retransmitted.
-   * A packet needs retransmission if it's indicated as not correctly received in a block ack
-   * frame.
-   */
-  std::list<PacketQueueI> m_retryPackets;
   std::list<Bar> m_bars; ///< list of BARs
 
   uint8_t m_blockAckThreshold; ///< bock ack threshold
@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <fstream>
+#include <limits>
 #include <string>
 
 namespace ns3 {
@@ -93,6 +94,38 @@ Codebook::GetTotalNumberOfAntennas (void) const
   return m_totalAntennas;
 }
 
+double
+Codebook::GetBestTxSector (double azimuth, SectorID &sectorID, AntennaID &antennaID)
+{
+  NS_LOG_FUNCTION (this << azimuth);
+  /* Save the active configuration, we only change the patterns used by GetTxGainDbi */
+  Ptr<PhasedAntennaArrayConfig> activeAntennaConfig = m_antennaConfig;
+  Ptr<PatternConfig> activeTxPattern = m_txPattern;
+  double bestGain = -std::numeric_limits<double>::infinity ();
+  for (AntennaArrayListCI antennaIter = m_antennaArrayList.begin (); antennaIter != m_antennaArrayList.end (); antennaIter++)
+    {
+      m_antennaConfig = antennaIter->second;
+      for (SectorListCI sectorIter = m_antennaConfig->sectorList.begin (); sectorIter != m_antennaConfig->sectorList.end (); sectorIter++)
+        {
+          if (sectorIter->second->sectorType == RX_SECTOR)
+            {
+              continue;
+            }
+          m_txPattern = sectorIter->second;
+          double gain = GetTxGainDbi (azimuth);
+          if (gain > bestGain)
+            {
+              bestGain = gain;
+              sectorID = sectorIter->first;
+              antennaID = antennaIter->first;
+            }
+        }
+    }
+  m_antennaConfig = activeAntennaConfig;
+  m_txPattern = activeTxPattern;
+  return bestGain;
+}
+
 void
 Codebook::SetBeaconingSectors (Antenna2SectorList sectors)
 {
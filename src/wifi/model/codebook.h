@@ -132,6 +132,15 @@ public:
   uint8_t GetTotalNumberOfSectors (void) const;
   virtual uint8_t GetNumberSectorsPerAntenna (AntennaID antennaID) const = 0;
   uint8_t GetTotalNumberOfAntennas (void) const;
+  /**
+   * Find the transmit sector with the highest gain toward a given direction. The active
+   * antenna configuration is left unchanged.
+   * \param azimuth The azimuth angle toward the peer station in radians.
+   * \param sectorID The ID of the best transmit sector.
+   * \param antennaID The ID of the antenna the best transmit sector belongs to.
+   * \return The gain of the best transmit sector in dBi.
+   */
+  double GetBestTxSector (double azimuth, SectorID &sectorID, AntennaID &antennaID);
   void SetBeaconingSectors (Antenna2SectorList sectors);
   void AppendBeaconingSector (AntennaID antennaID, SectorID sectorID);
   void RemoveBeaconingSector (AntennaID antennaID, SectorID sectorID);
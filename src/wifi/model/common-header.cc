@@ -11,6 +11,7 @@
 #include "dmg-information-elements.h"
 
 #include "supported-rates.h"
+#include "extended-capabilities.h"
 #include "ht-capabilities.h"
 #include "ht-operation.h"
 #include "erp-information.h"
@@ -106,6 +107,11 @@ MgtFrame::DeserializeInformationElements (Buffer::Iterator start)
               element = Create<ExtendedSupportedRatesIE> ();
               break;
             }
+          case IE_EXTENDED_CAPABILITIES:
+            {
+              element = Create<ExtendedCapabilities> ();
+              break;
+            }
           case IE_HT_CAPABILITIES:
             {
               element = Create<HtCapabilities> ();
@@ -176,6 +182,18 @@ MgtFrame::DeserializeInformationElements (Buffer::Iterator start)
               element = Create<StaAvailabilityElement> ();
               break;
             }
+          case IE_CLUSTER_REPORT:
+            {
+              element = Create<ClusterReportElement> ();
+              break;
+            }
+          default:
+            {
+              /* Skip the body of an element we do not know how to decode */
+              NS_LOG_DEBUG ("Skipping unsupported information element " << +id);
+              i.Next (length);
+              continue;
+            }
         }
 
       i = element->DeserializeElementBody (i, length);
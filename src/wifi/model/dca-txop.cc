@@ -73,7 +73,8 @@ DcaTxop::GetTypeId (void)
 
 DcaTxop::DcaTxop ()
   : m_manager (0),
-    m_currentPacket (0)
+    m_currentPacket (0),
+    m_allocationType (CBAP_ALLOCATION)
 {
   NS_LOG_FUNCTION (this);
   m_dcf = CreateObject<DcfState> (this);
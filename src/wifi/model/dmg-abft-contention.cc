@@ -0,0 +1,115 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2015-2019 IMDEA Networks Institute
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/trace-source-accessor.h"
+
+#include "dmg-abft-contention.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("DmgAbftContention");
+
+NS_OBJECT_ENSURE_REGISTERED (DmgAbftContention);
+
+TypeId
+DmgAbftContention::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::DmgAbftContention")
+    .SetParent<Object> ()
+    .SetGroupName ("Wifi")
+    .AddConstructor<DmgAbftContention> ()
+    .AddTraceSource ("SlotResolved", "An A-BFT SSW slot has been resolved.",
+                     MakeTraceSourceAccessor (&DmgAbftContention::m_slotResolved),
+                     "ns3::DmgAbftContention::SlotResolvedCallback")
+  ;
+  return tid;
+}
+
+DmgAbftContention::DmgAbftContention ()
+  : m_successfulSlots (0),
+    m_collidedSlots (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+DmgAbftContention::~DmgAbftContention ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+DmgAbftContention::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_bssStates.clear ();
+  Object::DoDispose ();
+}
+
+void
+DmgAbftContention::RegisterContender (Mac48Address bssid, uint8_t slot, uint8_t slots, Time abftDuration)
+{
+  NS_LOG_FUNCTION (this << bssid << uint16_t (slot) << uint16_t (slots) << abftDuration);
+  AbftState &state = m_bssStates[bssid];
+  /* The first registration after the end of the previous A-BFT opens a new A-BFT. STAs start
+   * the A-BFT at slightly different times due to the propagation delay, so we rely on the end
+   * of the A-BFT rather than on its exact starting time. */
+  if (Simulator::Now () >= state.end)
+    {
+      SlotState empty = {0, false};
+      state.end = Simulator::Now () + abftDuration;
+      state.slots.assign (slots, empty);
+    }
+  NS_ASSERT_MSG (slot < state.slots.size (), "SSW slot index exceeds the A-BFT length");
+  state.slots[slot].contenders++;
+}
+
+bool
+DmgAbftContention::ResolveSlot (Mac48Address bssid, uint8_t slot)
+{
+  NS_LOG_FUNCTION (this << bssid << uint16_t (slot));
+  AbftStateMap::iterator it = m_bssStates.find (bssid);
+  if ((it == m_bssStates.end ()) || (slot >= it->second.slots.size ()))
+    {
+      /* Unknown slot, fall back to the PHY simulation */
+      return true;
+    }
+  SlotState &state = it->second.slots[slot];
+  /* The PCP/AP receives in quasi-omni mode and locks onto the first SSW frame of the slot, so only
+   * the first contender is simulated at the PHY level while the others lose the slot. */
+  if (!state.resolved)
+    {
+      state.resolved = true;
+      if (state.contenders > 1)
+        {
+          m_collidedSlots++;
+        }
+      else
+        {
+          m_successfulSlots++;
+        }
+      m_slotResolved (bssid, slot, state.contenders);
+      return true;
+    }
+  NS_LOG_DEBUG ("SSW slot " << uint16_t (slot) << " of BSS " << bssid << " is collided with "
+                << state.contenders << " contenders");
+  return false;
+}
+
+uint64_t
+DmgAbftContention::GetSuccessfulSlots (void) const
+{
+  return m_successfulSlots;
+}
+
+uint64_t
+DmgAbftContention::GetCollidedSlots (void) const
+{
+  return m_collidedSlots;
+}
+
+} // namespace ns3
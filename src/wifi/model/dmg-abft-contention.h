@@ -0,0 +1,110 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2015-2019 IMDEA Networks Institute
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+#ifndef DMG_ABFT_CONTENTION_H
+#define DMG_ABFT_CONTENTION_H
+
+#include "ns3/mac48-address.h"
+#include "ns3/nstime.h"
+#include "ns3/object.h"
+#include "ns3/traced-callback.h"
+
+#include <map>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \ingroup wifi
+ *
+ * Logical A-BFT contention model. All the DMG STAs competing in the A-BFT of the
+ * same DMG PCP/AP share one instance of this class. Each STA registers the SSW slot
+ * it selected, and before starting its Responder Sector Sweep it asks the model
+ * whether it can access the slot. A collided slot is resolved logically: the PCP/AP
+ * locks onto the SSW frames of the first contender, which is the only one simulated
+ * at the PHY level, while the other contenders do not transmit and behave as if they
+ * missed the SSW-Feedback frame at the end of the slot.
+ *
+ * The state is kept per BSS and, inside each BSS, per A-BFT slot so both registration
+ * and resolution are constant time. A new A-BFT is detected when a STA registers
+ * after the end of the previous A-BFT of the same BSS, which follows the A-BFT
+ * periodicity (Next A-BFT field) announced by the PCP/AP.
+ */
+class DmgAbftContention : public Object
+{
+public:
+  static TypeId GetTypeId (void);
+
+  DmgAbftContention ();
+  virtual ~DmgAbftContention ();
+
+  /**
+   * Register a contender in the A-BFT of the given BSS.
+   * \param bssid The BSSID of the DMG PCP/AP.
+   * \param slot The index of the selected SSW slot.
+   * \param slots The number of SSW slots in the A-BFT (A-BFT Length).
+   * \param abftDuration The duration of the A-BFT.
+   */
+  void RegisterContender (Mac48Address bssid, uint8_t slot, uint8_t slots, Time abftDuration);
+  /**
+   * Resolve the contention of an SSW slot at the time a STA wants to access it.
+   * \param bssid The BSSID of the DMG PCP/AP.
+   * \param slot The index of the SSW slot.
+   * \return True if the STA should transmit its SSW frames through the PHY, false
+   * if the slot has already been taken by another contender.
+   */
+  bool ResolveSlot (Mac48Address bssid, uint8_t slot);
+  /**
+   * \return The number of slots resolved with a single contender.
+   */
+  uint64_t GetSuccessfulSlots (void) const;
+  /**
+   * \return The number of slots resolved as collided.
+   */
+  uint64_t GetCollidedSlots (void) const;
+
+  /**
+   * TracedCallback signature for SSW slot resolution.
+   *
+   * \param bssid The BSSID of the DMG PCP/AP.
+   * \param slot The index of the SSW slot.
+   * \param contenders The number of STAs contending in the slot.
+   */
+  typedef void (* SlotResolvedCallback)(Mac48Address bssid, uint8_t slot, uint16_t contenders);
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  /**
+   * Contention state of a single SSW slot.
+   */
+  struct SlotState
+  {
+    uint16_t contenders;    //!< Number of STAs that selected the slot.
+    bool resolved;          //!< Flag to indicate that a STA has accessed the slot.
+  };
+
+  /**
+   * Contention state of the current A-BFT of a BSS.
+   */
+  struct AbftState
+  {
+    Time end;                       //!< The end time of the current A-BFT.
+    std::vector<SlotState> slots;   //!< The state of each SSW slot.
+  };
+
+  typedef std::map<Mac48Address, AbftState> AbftStateMap;
+
+  AbftStateMap m_bssStates;         //!< The A-BFT state of each BSS.
+  uint64_t m_successfulSlots;       //!< Number of slots with a single contender.
+  uint64_t m_collidedSlots;         //!< Number of collided slots.
+  TracedCallback<Mac48Address, uint8_t, uint16_t> m_slotResolved;
+
+};
+
+} // namespace ns3
+
+#endif /* DMG_ABFT_CONTENTION_H */
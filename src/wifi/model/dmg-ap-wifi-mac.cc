@@ -9,17 +9,23 @@
 #include "ns3/string.h"
 #include "ns3/pointer.h"
 #include "ns3/boolean.h"
+#include "ns3/double.h"
 
 #include "amsdu-subframe-header.h"
 #include "dcf-manager.h"
 #include "dmg-ap-wifi-mac.h"
+#include "dmg-sta-wifi-mac.h"
 #include "ext-headers.h"
 #include "mac-low.h"
 #include "mac-rx-middle.h"
 #include "mac-tx-middle.h"
 #include "msdu-aggregator.h"
+#include "wifi-net-device.h"
 #include "wifi-utils.h"
 #include "wifi-phy.h"
+#include "snr-tag.h"
+
+#include <limits>
 
 namespace ns3 {
 
@@ -40,6 +46,13 @@ DmgApWifiMac::GetTypeId (void)
                    BooleanValue (true),
                    MakeBooleanAccessor (&DmgApWifiMac::m_allowBeaconing),
                    MakeBooleanChecker ())
+    .AddAttribute ("BhiAbstraction",
+                   "Whether the BHI is abstracted for large scale studies. The BTI and the A-BFT are accounted for as "
+                   "occupied time without transmitting DMG Beacons or SSW frames, the content of the DMG Beacon is "
+                   "delivered directly to the DMG STAs of the BSS, and the A-BFT beamforming is derived from the geometry.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&DmgApWifiMac::m_bhiAbstraction),
+                   MakeBooleanChecker ())
     .AddAttribute ("BeaconInterval", "The interval between two Target Beacon Transmission Times (TBTTs).",
                    TimeValue (aMaxBIDuration),
                    MakeTimeAccessor (&DmgApWifiMac::GetBeaconInterval,
@@ -135,6 +148,16 @@ DmgApWifiMac::GetTypeId (void)
                    TimeValue (Seconds (aMinChannelTime)),
                    MakeTimeAccessor (&DmgApWifiMac::m_channelMonitorTime),
                    MakeTimeChecker ())
+    .AddAttribute ("EnableSpatialReuse", "Allow the PCP/AP to share an occupied Beacon SP with cluster members "
+                   "whose DMG Beacons are received below the spatial reuse threshold.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&DmgApWifiMac::m_enableSpatialReuse),
+                   MakeBooleanChecker ())
+    .AddAttribute ("SpatialReuseThreshold", "The SNR of a DMG Beacon in dB below which the transmitting cluster member "
+                   "is considered non-interfering.",
+                   DoubleValue (10.0),
+                   MakeDoubleAccessor (&DmgApWifiMac::m_spatialReuseThreshold),
+                   MakeDoubleChecker<double> ())
 
     /* DMG Parameters */
     .AddAttribute ("CBAPSource", "Indicates that PCP/AP has a higher priority for transmission in CBAP",
@@ -159,6 +182,9 @@ DmgApWifiMac::GetTypeId (void)
     .AddTraceSource ("JoinedCluster", "The PCP/AP joined a cluster.",
                      MakeTraceSourceAccessor (&DmgApWifiMac::m_joinedCluster),
                      "ns3::DmgApWifiMac::JoinedClusterTracedCallback")
+    .AddTraceSource ("SharedBeaconSP", "The PCP/AP shares its Beacon SP with another cluster member.",
+                     MakeTraceSourceAccessor (&DmgApWifiMac::m_sharedBeaconSPTrace),
+                     "ns3::DmgApWifiMac::SharedBeaconSPCallback")
 
     /* Dynamic Allocation Traces */
     .AddTraceSource ("PPCompleted", "The Polling Period has ended.",
@@ -197,8 +223,10 @@ DmgApWifiMac::DmgApWifiMac ()
   /* Initialize Variables */
   m_receivedOneSSW = false;
   m_btiPeriodicity = 0;
+  m_abstractStationsFound = false;
   m_initiateDynamicAllocation = false;
   m_monitoringChannel = false;
+  m_sharedBeaconSP = false;
   // Let the lower layers know that we are acting as an AP.
   SetTypeOfStation (DMG_AP);
 }
@@ -214,6 +242,7 @@ DmgApWifiMac::DoDispose ()
   NS_LOG_FUNCTION (this);
   m_beaconDca = 0;
   m_beaconEvent.Cancel ();
+  m_abstractStations.clear ();
   DmgWifiMac::DoDispose ();
 }
 
@@ -669,6 +698,14 @@ DmgApWifiMac::CalculateBTIVariables (void)
   /* Service Set Identifier Information Element */
   beacon.SetSsid (GetSsid ());
 
+  /* Cluster Control Field */
+  if (m_enableCentralizedClustering || m_enableDecentralizedClustering)
+    {
+      ExtDMGBeaconIntervalCtrlField ctrl;
+      ctrl.SetCCPresent (true);
+      beacon.SetBeaconIntervalControlField (ctrl);
+    }
+
   if (m_announceDmgCapabilities)
     {
       beacon.AddWifiInformationElement (Create<DmgCapabilities> ());
@@ -693,6 +730,14 @@ DmgApWifiMac::CalculateBTIVariables (void)
     {
       beacon.AddWifiInformationElement (GetExtendedScheduleElement ());
     }
+  if (m_enableSpatialReuse && (m_clusterRole == PARTICIPATING))
+    {
+      Ptr<ClusterReportElement> report = GetClusterReportElement ();
+      if (report->GetNumberOfContraints () > 0)
+        {
+          beacon.AddWifiInformationElement (report);
+        }
+    }
   packet->AddHeader (beacon);
 
   /* Calculate durations */
@@ -705,16 +750,10 @@ DmgApWifiMac::CalculateBTIVariables (void)
                   GetSbifs () * (m_codebook->GetNumberOfSectorsInBHI () - 1);
 }
 
-void
-DmgApWifiMac::SendOneDMGBeacon (void)
+ExtDMGBeacon
+DmgApWifiMac::CreateDmgBeacon (void)
 {
   NS_LOG_FUNCTION (this);
-  WifiMacHeader hdr;
-  hdr.SetType (WIFI_MAC_EXTENSION_DMG_BEACON);
-  hdr.SetAddr1 (GetBssid ());     /* BSSID */
-  hdr.SetNoMoreFragments ();
-  hdr.SetNoRetry ();
-
   ExtDMGBeacon beacon;
 
   /* Timestamp */
@@ -826,6 +865,30 @@ DmgApWifiMac::SendOneDMGBeacon (void)
     {
       beacon.AddWifiInformationElement (GetExtendedScheduleElement ());
     }
+  /* Cluster Report Element to share the interference we measured with the other cluster members */
+  if (m_enableSpatialReuse && (m_clusterRole == PARTICIPATING))
+    {
+      Ptr<ClusterReportElement> report = GetClusterReportElement ();
+      if (report->GetNumberOfContraints () > 0)
+        {
+          beacon.AddWifiInformationElement (report);
+        }
+    }
+
+  return beacon;
+}
+
+void
+DmgApWifiMac::SendOneDMGBeacon (void)
+{
+  NS_LOG_FUNCTION (this);
+  WifiMacHeader hdr;
+  hdr.SetType (WIFI_MAC_EXTENSION_DMG_BEACON);
+  hdr.SetAddr1 (GetBssid ());     /* BSSID */
+  hdr.SetNoMoreFragments ();
+  hdr.SetNoRetry ();
+
+  ExtDMGBeacon beacon = CreateDmgBeacon ();
 
   Time btiRemaining = GetBTIRemainingTime ();
   NS_LOG_DEBUG ("BTI Remaining Time=" << btiRemaining);
@@ -880,10 +943,10 @@ DmgApWifiMac::AddGrantData (AllocationData info)
 uint8_t
 DmgApWifiMac::GetStationAid (Mac48Address address) const
 {
-  MAC_MAP_CI it = m_macMap.find (address);
-  if (it != m_macMap.end ())
+  uint16_t aid;
+  if (m_stationTable.GetAid (address, aid))
     {
-      return it->second;
+      return aid;
     }
   else
     {
@@ -894,15 +957,7 @@ DmgApWifiMac::GetStationAid (Mac48Address address) const
 Mac48Address
 DmgApWifiMac::GetStationAddress (uint8_t aid) const
 {
-  AID_MAP_CI it = m_aidMap.find (aid);
-  if (it != m_aidMap.end ())
-    {
-      return it->second;
-    }
-  else
-    {
-      return Mac48Address ();
-    }
+  return m_stationTable.GetAddress (aid);
 }
 
 Time
@@ -1011,7 +1066,7 @@ DmgApWifiMac::FrameTxOk (const WifiMacHeader &hdr)
             }
           Simulator::Schedule (2 * GetSifs (), &DmgApWifiMac::StartServicePeriod, this,
                                0, MicroSeconds (n_grantDynamicInfo.GetAllocationDuration ()),
-                               peerAid, m_aidMap[peerAid], isSource);
+                               peerAid, m_stationTable.GetAddress (peerAid), isSource);
         }
     }
   else if (hdr.IsSSW ())
@@ -1126,6 +1181,13 @@ DmgApWifiMac::StartBeaconInterval (void)
   Simulator::Schedule (m_beaconInterval, &DmgApWifiMac::EndBeaconInterval, this);
   NS_LOG_DEBUG ("Next BI will start at " << Simulator::Now () + m_beaconInterval);
 
+  if (m_bhiAbstraction)
+    {
+      /* We do not transmit DMG Beacons so there is no need to sense the channel */
+      StartBeaconHeaderInterval ();
+      return;
+    }
+
 //  if (m_enableDecentralizedClustering)
 //    {
 //      NS_LOG_DEBUG ("Decentralized clustering is enabled so avoid performing CCA before BHI.");
@@ -1200,7 +1262,89 @@ DmgApWifiMac::StartBeaconTransmissionInterval (void)
   /* Timing variables */
   CalculateBTIVariables ();
   m_btiStarted = Simulator::Now ();
-  m_beaconEvent = Simulator::ScheduleNow (&DmgApWifiMac::SendOneDMGBeacon, this);
+  if (m_bhiAbstraction)
+    {
+      DoAbstractBeaconHeaderInterval ();
+    }
+  else
+    {
+      m_beaconEvent = Simulator::ScheduleNow (&DmgApWifiMac::SendOneDMGBeacon, this);
+    }
+}
+
+void
+DmgApWifiMac::DoAbstractBeaconHeaderInterval (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_accessPeriod = CHANNEL_ACCESS_BHI;
+
+  /* Look up the DMG STAs sharing our channel once, they receive the content of the BHI directly */
+  if (!m_abstractStationsFound)
+    {
+      m_abstractStationsFound = true;
+      Ptr<Channel> channel = m_phy->GetChannel ();
+      for (uint32_t i = 0; i < channel->GetNDevices (); i++)
+        {
+          Ptr<WifiNetDevice> device = DynamicCast<WifiNetDevice> (channel->GetDevice (i));
+          if (device == 0)
+            {
+              continue;
+            }
+          Ptr<DmgStaWifiMac> station = DynamicCast<DmgStaWifiMac> (device->GetMac ());
+          if ((station != 0) && (device->GetPhy ()->GetChannelNumber () == m_phy->GetChannelNumber ()))
+            {
+              m_abstractStations.push_back (station);
+            }
+        }
+      NS_LOG_DEBUG ("Abstracted BHI covers " << m_abstractStations.size () << " DMG STAs");
+    }
+
+  ExtDMGBeacon beacon = CreateDmgBeacon ();
+
+  /* Same access period sequence as the one followed after the transmission of the last DMG Beacon */
+  Time nextAccessPeriod = m_btiDuration + GetMbifs ();
+  uint8_t availableSlots = 0;
+  if (m_nextAbft != 0)
+    {
+      m_nextAbft--;
+    }
+  else
+    {
+      m_nextAbft = m_abftPeriodicity;
+      nextAccessPeriod += m_abftDuration + GetMbifs ();
+      /* Each SSW slot of the A-BFT allows one DMG STA to complete its beamforming training */
+      availableSlots = m_ssSlotsPerABFT;
+    }
+
+  for (std::vector<Ptr<DmgStaWifiMac> >::iterator it = m_abstractStations.begin (); it != m_abstractStations.end (); it++)
+    {
+      Ptr<DmgStaWifiMac> station = *it;
+      if (!station->GetSsid ().IsEqual (GetSsid ()))
+        {
+          continue;
+        }
+      bool beamformingTraining = (availableSlots > 0) && !station->IsBeamformedTrained ();
+      Ptr<WifiPhy> stationPhy = station->GetWifiPhy ();
+      if (beamformingTraining)
+        {
+          availableSlots--;
+          CompleteAbstractSectorSweep (station->GetAddress (), stationPhy->GetMobility (),
+                                       CHANNEL_ACCESS_BHI, BeamformingInitiator);
+        }
+      Simulator::ScheduleWithContext (stationPhy->GetDevice ()->GetNode ()->GetId (), Seconds (0),
+                                      &DmgStaWifiMac::ReceiveAbstractDmgBeacon, station,
+                                      GetAddress (), m_phy->GetMobility (), beacon, nextAccessPeriod, beamformingTraining);
+    }
+
+  NS_LOG_DEBUG ("Abstracted BHI ends at " << Simulator::Now () + nextAccessPeriod);
+  if (m_atiPresent)
+    {
+      Simulator::Schedule (nextAccessPeriod, &DmgApWifiMac::StartAnnouncementTransmissionInterval, this);
+    }
+  else
+    {
+      Simulator::Schedule (nextAccessPeriod, &DmgApWifiMac::StartDataTransmissionInterval, this);
+    }
 }
 
 void
@@ -1361,7 +1505,7 @@ DmgApWifiMac::StartDataTransmissionInterval (void)
               if ((field.GetSourceAid () == AID_AP))
                 {
                   uint8_t destAid = field.GetDestinationAid ();
-                  Mac48Address destAddress = m_aidMap[destAid];
+                  Mac48Address destAddress = m_stationTable.GetAddress (destAid);
                   if (field.GetBfControl ().IsBeamformTraining ())
                     {
                       Simulator::Schedule (spStart, &DmgApWifiMac::StartBeamformingTraining, this, destAid, destAddress, true,
@@ -1369,18 +1513,18 @@ DmgApWifiMac::StartDataTransmissionInterval (void)
                     }
                   else
                     {
-                      DataForwardingTableIterator forwardingIterator = m_dataForwardingTable.find (destAddress);
-                      if (forwardingIterator == m_dataForwardingTable.end ())
+                      DmgStationRecord *record = m_stationTable.Find (destAddress);
+                      if ((record == 0) || !record->hasForwarding)
                         {
                           NS_LOG_ERROR ("Did not perform Beamforming Training with " << destAddress);
                           continue;
                         }
                       else
                         {
-                          forwardingIterator->second.isCbapPeriod = false;
+                          record->forwarding.isCbapPeriod = false;
                         }
                       uint8_t destAid = field.GetDestinationAid ();
-                      Mac48Address destAddress = m_aidMap[destAid];
+                      Mac48Address destAddress = m_stationTable.GetAddress (destAid);
                       ScheduleServicePeriod (field.GetNumberOfBlocks (), spStart, spLength, spPeriod,
                                              field.GetAllocationID (), destAid, destAddress, true);
                     }
@@ -1404,7 +1548,7 @@ DmgApWifiMac::StartDataTransmissionInterval (void)
               else if ((field.GetDestinationAid () == AID_AP) || (field.GetDestinationAid () == AID_BROADCAST))
                 {
                   uint8_t sourceAid = field.GetSourceAid ();
-                  Mac48Address sourceAddress = m_aidMap[sourceAid];
+                  Mac48Address sourceAddress = m_stationTable.GetAddress (sourceAid);
                   if (field.GetBfControl ().IsBeamformTraining ())
                     {
                       Simulator::Schedule (spStart, &DmgWifiMac::StartBeamformingTraining, this, sourceAid, sourceAddress, false,
@@ -1536,8 +1680,8 @@ DmgApWifiMac::SendGrantFrames (void)
     {
       /* If the communication is between two DMG STAs then sends two Grant frames */
       /* The Dynamic Allocation Info field within Grant frames transmitted as part of the same GP shall be the same */
-      Mac48Address dstAddress = m_aidMap[n_grantDynamicInfo.GetDestinationAID ()];
-      Mac48Address srcAddress = m_aidMap[n_grantDynamicInfo.GetSourceAID ()];
+      Mac48Address dstAddress = m_stationTable.GetAddress (n_grantDynamicInfo.GetDestinationAID ());
+      Mac48Address srcAddress = m_stationTable.GetAddress (n_grantDynamicInfo.GetSourceAID ());
 
       /* Send the second grant frame to the source station */
       Simulator::Schedule (GetSbifs () + m_grantFrameTxTime, &DmgApWifiMac::SendGrantFrame, this,
@@ -1780,6 +1924,7 @@ DmgApWifiMac::StartMonitoringBeaconSP (uint8_t beaconSPIndex)
 {
   NS_LOG_FUNCTION (this << uint16_t (beaconSPIndex));
   m_beaconReceived = false;
+  m_currentSpInterference.snr = -std::numeric_limits<double>::infinity ();
   if (beaconSPIndex == m_clusterMaxMem - 1)
     {
       NS_LOG_DEBUG ("We started monitoring last BeaconSP");
@@ -1808,27 +1953,133 @@ DmgApWifiMac::EndMonitoringBeaconSP (uint8_t beaconSPIndex)
       NS_LOG_DEBUG ("Received DMG Beacon during BeaconSP=" << uint16_t (beaconSPIndex));
       m_spStatus[beaconSPIndex] = m_beaconReceived;
     }
+  /* Keep the strongest interference seen during this Beacon SP over the whole monitor period */
+  if (m_beaconReceived)
+    {
+      BEACON_SP_INTERFERENCE_MAP::iterator it = m_spInterference.find (beaconSPIndex);
+      if ((it == m_spInterference.end ()) || (it->second.snr < m_currentSpInterference.snr))
+        {
+          m_spInterference[beaconSPIndex] = m_currentSpInterference;
+        }
+    }
 }
 
 void
-DmgApWifiMac::EndChannelMonitoring (Mac48Address clusterID)
+DmgApWifiMac::RecordClusterInterference (Mac48Address from, ExtDMGBeacon &beacon, double snr)
 {
-  NS_LOG_FUNCTION (this << clusterID);
-  m_monitoringChannel = false;
-  /* Search for empty BeaconSP */
+  NS_LOG_FUNCTION (this << from << snr);
+  if (snr > m_currentSpInterference.snr)
+    {
+      m_currentSpInterference.snr = snr;
+      m_currentSpInterference.interferer = from;
+    }
+  /* A cluster member we hear above the threshold is close to us, so the Beacon SPs in which it suffers
+   * interference should not be reused by us either */
+  Ptr<ClusterReportElement> report = StaticCast<ClusterReportElement> (beacon.GetInformationElement (IE_CLUSTER_REPORT));
+  if ((report == 0) || !report->GetTsConstPresent () || (snr < m_spatialReuseThreshold))
+    {
+      return;
+    }
+  ConstraintList constraints = report->GetTrafficSchedulingConstraintList ();
+  for (ConstraintListCI it = constraints.begin (); it != constraints.end (); it++)
+    {
+      uint8_t index = it->GetStartStartTime () / m_clusterTimeInterval.GetMicroSeconds ();
+      NS_LOG_DEBUG ("Cluster member " << from << " reported interference from " << it->GetInterfererAddress ()
+                    << " during BeaconSP=" << uint16_t (index));
+      m_spReported[index] = true;
+    }
+}
+
+bool
+DmgApWifiMac::SelectBeaconSP (uint8_t &beaconSPIndex, bool &shared) const
+{
+  NS_LOG_FUNCTION (this);
   for (BEACON_SP_STATUS_MAP_CI it = m_spStatus.begin (); it != m_spStatus.end (); it++)
     {
       if (it->second == false)
         {
-          /* Join the cluster upon finding an empty BeaconSP */
-          m_ClusterID = clusterID;
-          m_clusterRole = PARTICIPATING;
-          m_selectedBeaconSP = it->first;
-          m_joinedCluster (m_ClusterID, m_selectedBeaconSP);
-          NS_LOG_INFO ("DMG PCP/AP " << GetAddress () << " Joined ClusterID=" << clusterID
-                       << ", Sending DMG Beacons in [" << uint16_t (m_selectedBeaconSP) << "] BeaconSP");
-          return;
+          beaconSPIndex = it->first;
+          shared = false;
+          return true;
+        }
+    }
+  if (!m_enableSpatialReuse)
+    {
+      return false;
+    }
+  /* All the Beacon SPs are occupied, share the least interfered one. The first Beacon SP is
+   * reserved for the S-PCP/S-AP which synchronizes the cluster. */
+  bool found = false;
+  double minSnr = m_spatialReuseThreshold;
+  for (BEACON_SP_INTERFERENCE_MAP_CI it = m_spInterference.begin (); it != m_spInterference.end (); it++)
+    {
+      BEACON_SP_STATUS_MAP_CI reported = m_spReported.find (it->first);
+      if ((it->first == 0) || (it->second.snr >= minSnr)
+          || ((reported != m_spReported.end ()) && reported->second))
+        {
+          continue;
+        }
+      beaconSPIndex = it->first;
+      minSnr = it->second.snr;
+      found = true;
+    }
+  shared = found;
+  return found;
+}
+
+Ptr<ClusterReportElement>
+DmgApWifiMac::GetClusterReportElement (void) const
+{
+  Ptr<ClusterReportElement> report = Create<ClusterReportElement> ();
+  report->SetClusterReport (true);
+  report->SetReportedBssID (m_ClusterID);
+  report->SetReferenceTimestamp (static_cast<uint32_t> (m_biStartTime.GetMicroSeconds ()));
+  ExtDMGClusteringControlField cluster;
+  cluster.SetBeaconSpDuration (m_beaconSPDuration);
+  cluster.SetClusterMaxMem (m_clusterMaxMem);
+  cluster.SetClusterMemberRole (m_clusterRole);
+  cluster.SetClusterID (m_ClusterID);
+  report->SetClusteringControl (cluster);
+  /* One TSCONST per interfered Beacon SP, the start time is the offset of the Beacon SP from the TBTT */
+  for (BEACON_SP_INTERFERENCE_MAP_CI it = m_spInterference.begin (); it != m_spInterference.end (); it++)
+    {
+      if (it->second.snr >= m_spatialReuseThreshold)
+        {
+          ConstraintSubfield constraint;
+          constraint.SetStartStartTime (it->first * m_clusterTimeInterval.GetMicroSeconds ());
+          constraint.SetDuration (m_clusterBeaconSPDuration.GetMicroSeconds ());
+          constraint.SetInterfererAddress (it->second.interferer);
+          report->AddTrafficSchedulingConstraint (constraint);
+        }
+    }
+  report->SetTsConstPresent (report->GetNumberOfContraints () > 0);
+  return report;
+}
+
+void
+DmgApWifiMac::EndChannelMonitoring (Mac48Address clusterID)
+{
+  NS_LOG_FUNCTION (this << clusterID);
+  m_monitoringChannel = false;
+  /* Search for empty BeaconSP, or for a BeaconSP we can share */
+  uint8_t beaconSPIndex;
+  if (SelectBeaconSP (beaconSPIndex, m_sharedBeaconSP))
+    {
+      /* Join the cluster upon finding a BeaconSP */
+      m_ClusterID = clusterID;
+      m_clusterRole = PARTICIPATING;
+      m_selectedBeaconSP = beaconSPIndex;
+      m_joinedCluster (m_ClusterID, m_selectedBeaconSP);
+      if (m_sharedBeaconSP)
+        {
+          double snr = m_spInterference[m_selectedBeaconSP].snr;
+          m_sharedBeaconSPTrace (m_ClusterID, m_selectedBeaconSP, snr);
+          NS_LOG_INFO ("DMG PCP/AP " << GetAddress () << " shares BeaconSP [" << uint16_t (m_selectedBeaconSP)
+                       << "] with " << m_spInterference[m_selectedBeaconSP].interferer << ", SNR=" << snr << " dB");
         }
+      NS_LOG_INFO ("DMG PCP/AP " << GetAddress () << " Joined ClusterID=" << clusterID
+                   << ", Sending DMG Beacons in [" << uint16_t (m_selectedBeaconSP) << "] BeaconSP");
+      return;
     }
   NS_LOG_DEBUG ("Did not find an empty BeaconSP during channel monitoring time");
 }
@@ -2104,6 +2355,8 @@ DmgApWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
 
                   Time timeShift = (Simulator::Now () - m_biStartTime);
                   m_spStatus[0] = true; /* The first Beacon SP is reserved for S-PCP/S-AP */
+                  m_spInterference.clear ();
+                  m_spReported.clear ();
                   /* Initialize each SP Status to false and schedule monitoring period for each BeaconSP */
                   for (uint8_t n = 1; n < m_clusterMaxMem; n++)
                     {
@@ -2126,6 +2379,14 @@ DmgApWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
         {
           NS_LOG_LOGIC ("Received DMG Beacon frame during monitoring period with BSSID=" << hdr->GetAddr1 ());
           m_beaconReceived = true;
+          if (m_enableSpatialReuse)
+            {
+              ExtDMGBeacon beacon;
+              packet->RemoveHeader (beacon);
+              SnrTag tag;
+              packet->RemovePacketTag (tag);
+              RecordClusterInterference (hdr->GetAddr1 (), beacon, RatioToDb (tag.Get ()));
+            }
         }
       return;
     }
@@ -2187,9 +2448,10 @@ DmgApWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
                       AddMcsSupport (from, 13, capabilities->GetMaximumOfdmTxMcs ());
                     }
                   /* Record DMG Capabilities */
-                  StationInformation information;
-                  information.first = capabilities;
-                  m_informationMap[hdr->GetAddr2 ()] = information;
+                  DmgStationRecord &record = m_stationTable.Add (hdr->GetAddr2 ());
+                  record.hasInformation = true;
+                  record.information = StationInformation ();
+                  record.information.first = capabilities;
                   m_stationManager->AddStationDmgCapabilities (hdr->GetAddr2 (), capabilities);
 
                   /** Check Relay Capabilities **/
@@ -2433,11 +2695,12 @@ DmgApWifiMac::DeaggregateAmsduAndForward (Ptr<Packet> aggregatedPacket, const Wi
   MsduAggregator::DeaggregatedMsdus packets =
   MsduAggregator::Deaggregate (aggregatedPacket);
 
+  MsduAggregator::DeaggregatedMsdus local;
   for (MsduAggregator::DeaggregatedMsdusCI i = packets.begin (); i != packets.end (); ++i)
   {
     if ((*i).second.GetDestinationAddr () == GetAddress ())
       {
-        ForwardUp ((*i).first, (*i).second.GetSourceAddr (), (*i).second.GetDestinationAddr ());
+        local.push_back (*i);
       }
     else
       {
@@ -2447,6 +2710,7 @@ DmgApWifiMac::DeaggregateAmsduAndForward (Ptr<Packet> aggregatedPacket, const Wi
         ForwardDown ((*i).first, from, to, hdr->GetQosTid ());
       }
   }
+  ForwardUpBurst (local);
 }
 
 void
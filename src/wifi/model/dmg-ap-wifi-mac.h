@@ -28,6 +28,8 @@ namespace ns3 {
  * Handle association, dis-association and authentication,
  * of DMG STAs within an infrastructure DMG BSS.
  */
+class DmgStaWifiMac;
+
 class DmgApWifiMac : public DmgWifiMac
 {
 public:
@@ -296,6 +298,29 @@ protected:
    * Start Syn Beacon Interval.
    */
   void StartSynBeaconInterval (void);
+  /**
+   * Select the Beacon SP to join at the end of the channel monitoring. An empty Beacon SP is always
+   * preferred; otherwise, if spatial reuse is enabled, the PCP/AP shares the occupied Beacon SP with
+   * the weakest measured interference, provided it is below the spatial reuse threshold and no
+   * neighbouring cluster member reported interference during it.
+   * \param beaconSPIndex The index of the selected Beacon SP.
+   * \param shared Set to true if the selected Beacon SP is already used by another cluster member.
+   * \return True if a Beacon SP has been selected.
+   */
+  bool SelectBeaconSP (uint8_t &beaconSPIndex, bool &shared) const;
+  /**
+   * Record the interference measured from a DMG Beacon received while monitoring the channel and the
+   * interference reported by the transmitting cluster member.
+   * \param from The BSSID of the DMG Beacon.
+   * \param beacon The DMG Beacon.
+   * \param snr The SNR of the DMG Beacon in dB.
+   */
+  void RecordClusterInterference (Mac48Address from, ExtDMGBeacon &beacon, double snr);
+  /**
+   * \return The Cluster Report Element announcing the Beacon SPs in which we measured interference
+   * above the spatial reuse threshold.
+   */
+  Ptr<ClusterReportElement> GetClusterReportElement (void) const;
   /**
    * Return the DMG capability of the current PCP/AP.
    * \return the DMG capabilities the PCP/AP supports.
@@ -485,10 +510,21 @@ private:
    * Calculate BTI access period variables.
    */
   void CalculateBTIVariables (void);
+  /**
+   * Create a DMG Beacon frame body announcing the current parameters of the PCP/AP.
+   * \return The DMG Beacon frame body.
+   */
+  ExtDMGBeacon CreateDmgBeacon (void);
   /**
    * Send One DMG Beacon frame with the provided arguments.
    */
   void SendOneDMGBeacon (void);
+  /**
+   * Abstract the BHI: the BTI and the A-BFT are accounted for as occupied time only, the content
+   * of the DMG Beacon is delivered directly to the DMG STAs of the BSS and the beamforming training
+   * of the A-BFT is derived from the geometry of the stations.
+   */
+  void DoAbstractBeaconHeaderInterval (void);
   /**
    * Get Beacon Header Interval Duration
    * \return The duration of BHI.
@@ -518,6 +554,9 @@ private:
   Ptr<RandomVariableStream> m_beaconJitter; //!< RandomVariableStream used to randomize the time of the first DMG beacon.
   bool m_enableBeaconJitter;            //!< Flag whether the first beacon should be generated at random time.
   bool m_allowBeaconing;                //!< Flag to indicate whether we want to start Beaconing upon initialization.
+  bool m_bhiAbstraction;                //!< Flag to indicate whether the BHI is abstracted instead of simulated frame by frame.
+  bool m_abstractStationsFound;         //!< Flag to indicate whether we looked up the DMG STAs for the abstracted BHI.
+  std::vector<Ptr<DmgStaWifiMac> > m_abstractStations; //!< The DMG STAs receiving the abstracted BHI.
   bool m_announceDmgCapabilities;       //!< Flag to indicate whether we announce DMG Capabilities in DMG Beacons.
   bool m_announceOperationElement;      //!< Flag to indicate whether we transmit DMG operation element in DMG Beacons.
   bool m_scheduleElement;               //!< Flag to indicate whether we transmit Extended Schedule element in DMG Beacons.
@@ -536,6 +575,22 @@ private:
   BEACON_SP_STATUS_MAP m_spStatus;      //!< The status of each Beacon SP in the monitor period.
   bool m_monitoringChannel;             //!< Flag to indicate if we have started monitoring the channel for cluster formation.
   bool m_beaconReceived;                //!< Flag to indicate if we have received beacon during BeaconSP.
+  bool m_enableSpatialReuse;            //!< Flag to indicate if cluster members can share Beacon SPs.
+  double m_spatialReuseThreshold;       //!< The SNR in dB below which a cluster member is considered non-interfering.
+  /**
+   * Interference measured during a Beacon SP.
+   */
+  struct BeaconSpInterference
+  {
+    double snr;                         //!< The strongest DMG Beacon SNR in dB.
+    Mac48Address interferer;            //!< The BSSID of the strongest DMG Beacon.
+  };
+  typedef std::map<uint8_t, BeaconSpInterference> BEACON_SP_INTERFERENCE_MAP;           //!< Typedef for mapping the interference of each BeaconSP.
+  typedef BEACON_SP_INTERFERENCE_MAP::const_iterator BEACON_SP_INTERFERENCE_MAP_CI;     //!< Typedef for const iterator through BeaconSP interference.
+  BEACON_SP_INTERFERENCE_MAP m_spInterference;  //!< The interference measured during each Beacon SP in the monitor period.
+  BEACON_SP_STATUS_MAP m_spReported;    //!< Beacon SPs in which a neighbouring cluster member reported interference.
+  BeaconSpInterference m_currentSpInterference; //!< The interference measured during the current Beacon SP.
+  bool m_sharedBeaconSP;                //!< Flag to indicate that our Beacon SP is shared with another cluster member.
   uint8_t m_selectedBeaconSP;           //!< Selected Beacon SP for DMG Transmission.
   Time m_clusterTimeInterval;           //!< The interval between two consectuve Beacon SPs.
   Time m_channelMonitorTime;            //!< The channel monitor time.
@@ -543,6 +598,7 @@ private:
   Time m_clusterBeaconSPDuration;       //!< The duration of the Beacon SP.
 
   TracedCallback<Mac48Address, uint8_t> m_joinedCluster;  //!< The PCP/AP has joined a cluster.
+  TracedCallback<Mac48Address, uint8_t, double> m_sharedBeaconSPTrace;  //!< The PCP/AP shares its Beacon SP with another cluster member.
   /**
    * TracedCallback signature for DTI access period start event.
    *
@@ -550,6 +606,14 @@ private:
    * \param beaconSP The index of the BeaconSP.
    */
   typedef void (* JoinedClusterCallback)(Mac48Address clusterID, uint8_t index);
+  /**
+   * TracedCallback signature for Beacon SP sharing.
+   *
+   * \param clusterID The MAC address of the cluster.
+   * \param beaconSP The index of the shared BeaconSP.
+   * \param snr The interference measured during the shared BeaconSP in dB.
+   */
+  typedef void (* SharedBeaconSPCallback)(Mac48Address clusterID, uint8_t index, double snr);
 
   /** A-BFT Access Period Variables **/
   uint8_t m_abftPeriodicity;            //!< The periodicity of the A-BFT in DMG Beacon.
@@ -188,6 +188,11 @@ SNR2BER_STRUCT::InterpolateAndRetrieveData (double xd, double x1d, double x2d)
     {
       fq2 = (*elemIter).second;
     }
+  if (x1 == x2)
+    {
+      /* The SNR falls on a datapoint, there is nothing to interpolate */
+      return fq1;
+    }
   fp = (((x2d - xd) / (x2d - x1d)) * fq1) + (((xd - x1d) / (x2d - x1d)) * fq2);
   NS_LOG_DEBUG ("BER1=" << fq1 << ", BER2=" << fq2 << ", BER=" << fp);
   return fp;
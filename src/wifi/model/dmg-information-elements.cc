@@ -4441,7 +4441,7 @@ ClusterReportElement::DeserializeInformationField (Buffer::Iterator start, uint8
 void
 ClusterReportElement::SetClusterRequest (bool request)
 {
-  m_clusterReport = request;
+  m_clusterRequest = request;
 }
 
 void
@@ -0,0 +1,284 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2015-2019 IMDEA Networks Institute
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+
+#include "ns3/log.h"
+#include "dmg-remote-signal-header.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("DmgRemoteSignalHeader");
+
+NS_OBJECT_ENSURE_REGISTERED (DmgRemoteSignalHeader);
+
+/* Serialized size of a receiver: index, antenna gain and delay */
+#define REMOTE_RECEIVER_SIZE (4 + sizeof (double) + 8)
+
+DmgRemoteSignalHeader::DmgRemoteSignalHeader ()
+  : m_fieldType (PLCP_80211AD_PREAMBLE_HDR_DATA),
+    m_senderIndex (0),
+    m_txPowerDbm (0),
+    m_isAmpdu (false)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+DmgRemoteSignalHeader::~DmgRemoteSignalHeader ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+TypeId
+DmgRemoteSignalHeader::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::DmgRemoteSignalHeader")
+    .SetParent<Header> ()
+    .SetGroupName ("Wifi")
+    .AddConstructor<DmgRemoteSignalHeader> ()
+  ;
+  return tid;
+}
+
+TypeId
+DmgRemoteSignalHeader::GetInstanceTypeId (void) const
+{
+  return GetTypeId ();
+}
+
+void
+DmgRemoteSignalHeader::Print (std::ostream &os) const
+{
+  os << "Field=" << m_fieldType
+     << ", Sender=" << m_senderIndex
+     << ", TxTime=" << m_txTime
+     << ", TxPower=" << m_txPowerDbm
+     << ", Duration=" << m_duration
+     << ", Receivers=" << m_receivers.size ();
+}
+
+uint32_t
+DmgRemoteSignalHeader::GetSerializedSize (void) const
+{
+  uint32_t size = 0;
+  size += 1;                                  // Field Type
+  size += 4;                                  // Sender Index
+  size += 8;                                  // Tx Time
+  size += sizeof (double);                    // Tx Power
+  size += 8;                                  // Duration
+  size += 4 + m_phyTag.GetSerializedSize ();  // WifiPhyTag
+  size += 1;                                  // A-MPDU Flag
+  if (m_isAmpdu)
+    {
+      size += 4 + m_ampduTag.GetSerializedSize ();
+    }
+  size += 4 + m_receivers.size () * REMOTE_RECEIVER_SIZE;
+  return size;
+}
+
+void
+DmgRemoteSignalHeader::Serialize (Buffer::Iterator start) const
+{
+  NS_LOG_FUNCTION (this << &start);
+  Buffer::Iterator i = start;
+  std::vector<uint8_t> tagData;
+
+  i.WriteU8 (static_cast<uint8_t> (m_fieldType));
+  i.WriteHtolsbU32 (m_senderIndex);
+  i.WriteHtolsbU64 (m_txTime.GetTimeStep ());
+  i.Write ((uint8_t *)&m_txPowerDbm, sizeof (double));
+  i.WriteHtolsbU64 (m_duration.GetTimeStep ());
+
+  /* The packet does not serialize its tags, so they are carried by the header */
+  tagData.resize (m_phyTag.GetSerializedSize ());
+  m_phyTag.Serialize (TagBuffer (tagData.data (), tagData.data () + tagData.size ()));
+  i.WriteHtolsbU32 (tagData.size ());
+  i.Write (tagData.data (), tagData.size ());
+
+  i.WriteU8 (m_isAmpdu);
+  if (m_isAmpdu)
+    {
+      tagData.resize (m_ampduTag.GetSerializedSize ());
+      m_ampduTag.Serialize (TagBuffer (tagData.data (), tagData.data () + tagData.size ()));
+      i.WriteHtolsbU32 (tagData.size ());
+      i.Write (tagData.data (), tagData.size ());
+    }
+
+  i.WriteHtolsbU32 (m_receivers.size ());
+  for (ReceiverListCI it = m_receivers.begin (); it != m_receivers.end (); it++)
+    {
+      i.WriteHtolsbU32 (it->phyIndex);
+      i.Write ((uint8_t *)&it->txAntennaGainDbi, sizeof (double));
+      i.WriteHtolsbU64 (it->delay.GetTimeStep ());
+    }
+}
+
+uint32_t
+DmgRemoteSignalHeader::Deserialize (Buffer::Iterator start)
+{
+  NS_LOG_FUNCTION (this << &start);
+  Buffer::Iterator i = start;
+  std::vector<uint8_t> tagData;
+
+  m_fieldType = static_cast<PLCP_FIELD_TYPE> (i.ReadU8 ());
+  m_senderIndex = i.ReadLsbtohU32 ();
+  m_txTime = TimeStep (i.ReadLsbtohU64 ());
+  i.Read ((uint8_t *)&m_txPowerDbm, sizeof (double));
+  m_duration = TimeStep (i.ReadLsbtohU64 ());
+
+  tagData.resize (i.ReadLsbtohU32 ());
+  i.Read (tagData.data (), tagData.size ());
+  m_phyTag.Deserialize (TagBuffer (tagData.data (), tagData.data () + tagData.size ()));
+
+  m_isAmpdu = i.ReadU8 ();
+  if (m_isAmpdu)
+    {
+      tagData.resize (i.ReadLsbtohU32 ());
+      i.Read (tagData.data (), tagData.size ());
+      m_ampduTag.Deserialize (TagBuffer (tagData.data (), tagData.data () + tagData.size ()));
+    }
+
+  m_receivers.resize (i.ReadLsbtohU32 ());
+  for (ReceiverList::iterator it = m_receivers.begin (); it != m_receivers.end (); it++)
+    {
+      it->phyIndex = i.ReadLsbtohU32 ();
+      i.Read ((uint8_t *)&it->txAntennaGainDbi, sizeof (double));
+      it->delay = TimeStep (i.ReadLsbtohU64 ());
+    }
+
+  return i.GetDistanceFrom (start);
+}
+
+void
+DmgRemoteSignalHeader::SetFieldType (PLCP_FIELD_TYPE type)
+{
+  m_fieldType = type;
+}
+
+void
+DmgRemoteSignalHeader::SetSenderIndex (uint32_t index)
+{
+  m_senderIndex = index;
+}
+
+void
+DmgRemoteSignalHeader::SetTxTime (Time txTime)
+{
+  m_txTime = txTime;
+}
+
+void
+DmgRemoteSignalHeader::SetTxPowerDbm (double txPowerDbm)
+{
+  m_txPowerDbm = txPowerDbm;
+}
+
+void
+DmgRemoteSignalHeader::SetDuration (Time duration)
+{
+  m_duration = duration;
+}
+
+void
+DmgRemoteSignalHeader::SetWifiPhyTag (const WifiPhyTag &tag)
+{
+  m_phyTag = tag;
+}
+
+void
+DmgRemoteSignalHeader::SetAmpduTag (const AmpduTag &tag)
+{
+  m_ampduTag = tag;
+  m_isAmpdu = true;
+}
+
+void
+DmgRemoteSignalHeader::AddReceiver (uint32_t phyIndex, double txAntennaGainDbi, Time delay)
+{
+  Receiver receiver;
+  receiver.phyIndex = phyIndex;
+  receiver.txAntennaGainDbi = txAntennaGainDbi;
+  receiver.delay = delay;
+  m_receivers.push_back (receiver);
+}
+
+PLCP_FIELD_TYPE
+DmgRemoteSignalHeader::GetFieldType (void) const
+{
+  return m_fieldType;
+}
+
+uint32_t
+DmgRemoteSignalHeader::GetSenderIndex (void) const
+{
+  return m_senderIndex;
+}
+
+Time
+DmgRemoteSignalHeader::GetTxTime (void) const
+{
+  return m_txTime;
+}
+
+double
+DmgRemoteSignalHeader::GetTxPowerDbm (void) const
+{
+  return m_txPowerDbm;
+}
+
+Time
+DmgRemoteSignalHeader::GetDuration (void) const
+{
+  return m_duration;
+}
+
+WifiPhyTag
+DmgRemoteSignalHeader::GetWifiPhyTag (void) const
+{
+  return m_phyTag;
+}
+
+bool
+DmgRemoteSignalHeader::GetAmpduTag (AmpduTag &tag) const
+{
+  if (m_isAmpdu)
+    {
+      tag = m_ampduTag;
+    }
+  return m_isAmpdu;
+}
+
+const DmgRemoteSignalHeader::ReceiverList &
+DmgRemoteSignalHeader::GetReceivers (void) const
+{
+  return m_receivers;
+}
+
+Time
+DmgRemoteSignalHeader::GetMinimumDelay (void) const
+{
+  NS_ASSERT (!m_receivers.empty ());
+  Time delay = m_receivers.front ().delay;
+  for (ReceiverListCI it = m_receivers.begin (); it != m_receivers.end (); it++)
+    {
+      delay = std::min (delay, it->delay);
+    }
+  return delay;
+}
+
+} // namespace ns3
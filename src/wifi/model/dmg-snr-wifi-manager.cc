@@ -0,0 +1,424 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2015-2019 IMDEA Networks Institute
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+
+#include "ns3/abort.h"
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/uinteger.h"
+
+#include "dmg-snr-wifi-manager.h"
+#include "error-rate-model.h"
+#include "wifi-phy.h"
+#include "wifi-utils.h"
+
+#include <algorithm>
+#include <limits>
+
+#define Min(a,b) ((a < b) ? a : b)
+
+namespace ns3 {
+
+/* The SNR range in dB searched for the threshold of each MCS */
+#define SNR_THRESHOLD_MIN_DB    -20.0
+#define SNR_THRESHOLD_MAX_DB    60.0
+/* The number of bisection steps used to find the threshold, gives a precision below 0.01 dB */
+#define SNR_THRESHOLD_STEPS     16
+
+/**
+ * \brief hold per-remote-station state for the DMG SNR Wifi manager.
+ *
+ * This struct extends from WifiRemoteStation struct to hold additional
+ * information required by the DMG SNR Wifi manager
+ */
+struct DmgSnrWifiRemoteStation : public WifiRemoteStation
+{
+  double m_snr;           //!< Latest SNR (linear) of the link with the remote station, zero if unknown.
+  bool m_stale;           //!< Flag to indicate that the MCS must be selected again.
+  uint32_t m_failures;    //!< Number of consecutive failed transmissions.
+  uint32_t m_successes;   //!< Number of consecutive successful transmissions.
+  uint8_t m_stepDown;     //!< Number of MCSs removed from the SNR-based selection after repeated failures.
+  uint8_t m_nSupported;   //!< Size of the operational rate set when the support bitmap was built.
+  uint64_t m_supported;   //!< Bitmap of the candidate MCSs supported by the remote station.
+  double m_lowSnr;        //!< Lowest SNR (linear) for which the SNR-based selection remains valid.
+  double m_highSnr;       //!< SNR (linear) from which a faster MCS can be selected.
+  WifiMode m_mode;        //!< The MCS selected for the remote station.
+};
+
+NS_OBJECT_ENSURE_REGISTERED (DmgSnrWifiManager);
+
+NS_LOG_COMPONENT_DEFINE ("DmgSnrWifiManager");
+
+TypeId
+DmgSnrWifiManager::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::DmgSnrWifiManager")
+    .SetParent<WifiRemoteStationManager> ()
+    .SetGroupName ("Wifi")
+    .AddConstructor<DmgSnrWifiManager> ()
+    .AddAttribute ("TargetPer",
+                   "The maximum packet error rate acceptable at any MCS for a frame of the reference size.",
+                   DoubleValue (0.1),
+                   MakeDoubleAccessor (&DmgSnrWifiManager::m_targetPer),
+                   MakeDoubleChecker<double> (0, 1))
+    .AddAttribute ("ReferenceFrameSize",
+                   "The size in bytes of the frame used to compute the SNR threshold of each MCS.",
+                   UintegerValue (1500),
+                   MakeUintegerAccessor (&DmgSnrWifiManager::m_referenceFrameSize),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("FailureThreshold",
+                   "The number of consecutive failed transmissions after which the MCS is stepped down "
+                   "until a new SNR value is reported.",
+                   UintegerValue (2),
+                   MakeUintegerAccessor (&DmgSnrWifiManager::m_failureThreshold),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("SuccessThreshold",
+                   "The number of consecutive successful transmissions after which a step down is undone.",
+                   UintegerValue (10),
+                   MakeUintegerAccessor (&DmgSnrWifiManager::m_successThreshold),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddTraceSource ("Rate",
+                     "Traced value for rate changes (b/s)",
+                     MakeTraceSourceAccessor (&DmgSnrWifiManager::m_currentRate),
+                     "ns3::TracedValueCallback::Uint64")
+  ;
+  return tid;
+}
+
+DmgSnrWifiManager::DmgSnrWifiManager ()
+  : m_currentRate (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+DmgSnrWifiManager::~DmgSnrWifiManager ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+DmgSnrWifiManager::SetupPhy (const Ptr<WifiPhy> phy)
+{
+  NS_LOG_FUNCTION (this << phy);
+  WifiRemoteStationManager::SetupPhy (phy);
+}
+
+double
+DmgSnrWifiManager::CalculateSnrThreshold (WifiMode mode) const
+{
+  NS_LOG_FUNCTION (this << mode);
+  Ptr<ErrorRateModel> model = GetPhy ()->GetErrorRateModel ();
+  WifiTxVector txVector;
+  txVector.SetMode (mode);
+  txVector.SetChannelWidth (GetPhy ()->GetChannelWidth ());
+  uint64_t nbits = m_referenceFrameSize * 8;
+  double psr = 1 - m_targetPer;
+  double low = SNR_THRESHOLD_MIN_DB;
+  double high = SNR_THRESHOLD_MAX_DB;
+  if (model->GetChunkSuccessRate (mode, txVector, DbToRatio (high), nbits) < psr)
+    {
+      return -1;
+    }
+  for (uint8_t i = 0; i < SNR_THRESHOLD_STEPS; i++)
+    {
+      double middle = (low + high) / 2;
+      if (model->GetChunkSuccessRate (mode, txVector, DbToRatio (middle), nbits) < psr)
+        {
+          low = middle;
+        }
+      else
+        {
+          high = middle;
+        }
+    }
+  return DbToRatio (high);
+}
+
+bool
+DmgSnrWifiManager::CompareDataRate (const Candidate &a, const Candidate &b)
+{
+  return a.dataRate < b.dataRate;
+}
+
+void
+DmgSnrWifiManager::DoInitialize ()
+{
+  NS_LOG_FUNCTION (this);
+  m_candidates.clear ();
+  for (uint8_t i = 0; i < GetPhy ()->GetNModes (); i++)
+    {
+      WifiMode mode = GetPhy ()->GetMode (i);
+      /* Data frames are sent with the SC and OFDM PHYs only, the extended SC MCSs (e.g. DMG_MCS9_1)
+       * reuse the MCS index of a base MCS and are not covered by the DMG error models */
+      if ((mode.GetModulationClass () != WIFI_MOD_CLASS_DMG_SC && mode.GetModulationClass () != WIFI_MOD_CLASS_DMG_OFDM)
+          || (mode.GetUniqueName ().find ('_', 4) != std::string::npos))
+        {
+          continue;
+        }
+      Candidate candidate;
+      candidate.mode = mode;
+      candidate.dataRate = mode.GetDataRate ();
+      candidate.threshold = CalculateSnrThreshold (mode);
+      if (candidate.threshold < 0)
+        {
+          NS_LOG_DEBUG ("Skipping mode " << mode.GetUniqueName () << ", target PER cannot be reached");
+          continue;
+        }
+      NS_LOG_DEBUG ("Adding mode " << mode.GetUniqueName () << " threshold " << RatioToDb (candidate.threshold) << " dB");
+      m_candidates.push_back (candidate);
+    }
+  NS_ABORT_MSG_IF (m_candidates.empty (), "No DMG MCS can be used for data transmission");
+  NS_ABORT_MSG_IF (m_candidates.size () > 64, "Too many DMG MCSs for the support bitmap");
+  std::stable_sort (m_candidates.begin (), m_candidates.end (), &DmgSnrWifiManager::CompareDataRate);
+}
+
+WifiRemoteStation *
+DmgSnrWifiManager::DoCreateStation (void) const
+{
+  NS_LOG_FUNCTION (this);
+  DmgSnrWifiRemoteStation *station = new DmgSnrWifiRemoteStation ();
+  station->m_snr = 0;
+  station->m_stale = true;
+  station->m_failures = 0;
+  station->m_successes = 0;
+  station->m_stepDown = 0;
+  station->m_nSupported = 0;
+  station->m_supported = 0;
+  station->m_lowSnr = 0;
+  station->m_highSnr = 0;
+  station->m_mode = GetDefaultMode ();
+  return station;
+}
+
+void
+DmgSnrWifiManager::UpdateSnr (WifiRemoteStation *st, double snr)
+{
+  NS_LOG_FUNCTION (this << st << snr);
+  DmgSnrWifiRemoteStation *station = (DmgSnrWifiRemoteStation *)st;
+  station->m_snr = snr;
+  if ((snr < station->m_lowSnr) || (snr >= station->m_highSnr))
+    {
+      /* The SNR left the range of the current selection, so the channel has changed and the
+       * previous step down no longer applies */
+      station->m_stepDown = 0;
+      station->m_stale = true;
+    }
+}
+
+void
+DmgSnrWifiManager::ReportSuccess (WifiRemoteStation *st, double dataSnr)
+{
+  NS_LOG_FUNCTION (this << st << dataSnr);
+  DmgSnrWifiRemoteStation *station = (DmgSnrWifiRemoteStation *)st;
+  station->m_failures = 0;
+  station->m_successes++;
+  if ((station->m_stepDown > 0) && (station->m_successes >= m_successThreshold))
+    {
+      /* The failures were transient, move back towards the SNR-based selection */
+      station->m_successes = 0;
+      station->m_stepDown--;
+      station->m_stale = true;
+    }
+  if (dataSnr == 0)
+    {
+      NS_LOG_WARN ("DataSnr reported to be zero; not saving this report.");
+      return;
+    }
+  UpdateSnr (station, dataSnr);
+}
+
+void
+DmgSnrWifiManager::ReportFailure (WifiRemoteStation *st)
+{
+  NS_LOG_FUNCTION (this << st);
+  DmgSnrWifiRemoteStation *station = (DmgSnrWifiRemoteStation *)st;
+  station->m_successes = 0;
+  station->m_failures++;
+  if ((station->m_failures >= m_failureThreshold) && (station->m_stepDown < m_candidates.size ()))
+    {
+      station->m_failures = 0;
+      station->m_stepDown++;
+      station->m_stale = true;
+    }
+}
+
+void
+DmgSnrWifiManager::SelectMode (WifiRemoteStation *st)
+{
+  NS_LOG_FUNCTION (this << st);
+  DmgSnrWifiRemoteStation *station = (DmgSnrWifiRemoteStation *)st;
+  if (station->m_nSupported != GetNSupported (station))
+    {
+      /* The operational rate set only grows upon association, so the bitmap is rarely rebuilt */
+      station->m_nSupported = GetNSupported (station);
+      station->m_supported = 0;
+      for (uint8_t i = 0; i < station->m_nSupported; i++)
+        {
+          WifiMode mode = GetSupported (station, i);
+          for (uint8_t j = 0; j < m_candidates.size (); j++)
+            {
+              if (m_candidates[j].mode == mode)
+                {
+                  station->m_supported |= (uint64_t (1) << j);
+                }
+            }
+        }
+    }
+
+  /* The thresholds are not monotonic with the data rate (e.g. DMG_MCS5 and DMG_MCS6), so we
+   * walk down from the fastest MCS and take the first supported one the SNR can sustain. The
+   * faster MCSs we skip bound the SNR range over which this selection remains valid. */
+  int selected = -1;
+  int lowest = -1;
+  double highSnr = std::numeric_limits<double>::infinity ();
+  for (int i = m_candidates.size () - 1; i >= 0; i--)
+    {
+      if ((station->m_supported & (uint64_t (1) << i)) == 0)
+        {
+          continue;
+        }
+      lowest = i;
+      if (selected < 0)
+        {
+          if (m_candidates[i].threshold <= station->m_snr)
+            {
+              selected = i;
+            }
+          else
+            {
+              highSnr = std::min (highSnr, m_candidates[i].threshold);
+            }
+        }
+    }
+  if (selected < 0)
+    {
+      /* Either the SNR is unknown or too low, or the remote station does not support any candidate */
+      selected = (lowest < 0) ? 0 : lowest;
+      station->m_lowSnr = 0;
+    }
+  else
+    {
+      station->m_lowSnr = m_candidates[selected].threshold;
+    }
+  station->m_highSnr = highSnr;
+
+  /* Step down below the SNR-based selection after repeated failures */
+  uint8_t stepDown = station->m_stepDown;
+  for (int i = selected - 1; (i >= 0) && (stepDown > 0); i--)
+    {
+      if ((station->m_supported & (uint64_t (1) << i)) != 0)
+        {
+          selected = i;
+          stepDown--;
+        }
+    }
+  station->m_mode = m_candidates[selected].mode;
+  station->m_stale = false;
+  NS_LOG_DEBUG ("Selected mode " << station->m_mode.GetUniqueName () << " for SNR " << RatioToDb (station->m_snr)
+                << " dB and step down " << uint16_t (station->m_stepDown));
+}
+
+void
+DmgSnrWifiManager::DoReportRxOk (WifiRemoteStation *station, double rxSnr, WifiMode txMode)
+{
+  NS_LOG_FUNCTION (this << station << rxSnr << txMode);
+}
+
+void
+DmgSnrWifiManager::DoReportRtsFailed (WifiRemoteStation *station)
+{
+  NS_LOG_FUNCTION (this << station);
+}
+
+void
+DmgSnrWifiManager::DoReportDataFailed (WifiRemoteStation *station)
+{
+  NS_LOG_FUNCTION (this << station);
+  ReportFailure (station);
+}
+
+void
+DmgSnrWifiManager::DoReportRtsOk (WifiRemoteStation *station,
+                                  double ctsSnr, WifiMode ctsMode, double rtsSnr)
+{
+  NS_LOG_FUNCTION (this << station << ctsSnr << ctsMode.GetUniqueName () << rtsSnr);
+}
+
+void
+DmgSnrWifiManager::DoReportDataOk (WifiRemoteStation *station,
+                                   double ackSnr, WifiMode ackMode, double dataSnr)
+{
+  NS_LOG_FUNCTION (this << station << ackSnr << ackMode.GetUniqueName () << dataSnr);
+  ReportSuccess (station, dataSnr);
+}
+
+void
+DmgSnrWifiManager::DoReportAmpduTxStatus (WifiRemoteStation *station, uint8_t nSuccessfulMpdus, uint8_t nFailedMpdus,
+                                          double rxSnr, double dataSnr)
+{
+  NS_LOG_FUNCTION (this << station << +nSuccessfulMpdus << +nFailedMpdus << rxSnr << dataSnr);
+  if ((nSuccessfulMpdus == 0) || (nFailedMpdus > nSuccessfulMpdus))
+    {
+      /* The Block ACK was missed or most of the A-MPDU was lost */
+      ReportFailure (station);
+      return;
+    }
+  ReportSuccess (station, dataSnr);
+}
+
+void
+DmgSnrWifiManager::DoReportBeamformingSnr (WifiRemoteStation *station, double snr)
+{
+  NS_LOG_FUNCTION (this << station << snr);
+  UpdateSnr (station, snr);
+}
+
+void
+DmgSnrWifiManager::DoReportFinalRtsFailed (WifiRemoteStation *station)
+{
+  NS_LOG_FUNCTION (this << station);
+}
+
+void
+DmgSnrWifiManager::DoReportFinalDataFailed (WifiRemoteStation *station)
+{
+  NS_LOG_FUNCTION (this << station);
+}
+
+WifiTxVector
+DmgSnrWifiManager::DoGetDataTxVector (WifiRemoteStation *st)
+{
+  NS_LOG_FUNCTION (this << st);
+  DmgSnrWifiRemoteStation *station = (DmgSnrWifiRemoteStation *)st;
+  if (station->m_stale || (station->m_nSupported != GetNSupported (station)))
+    {
+      SelectMode (station);
+    }
+  WifiMode mode = station->m_mode;
+  if (m_currentRate != mode.GetDataRate ())
+    {
+      NS_LOG_DEBUG ("New datarate: " << mode.GetDataRate ());
+      m_currentRate = mode.GetDataRate ();
+    }
+  return WifiTxVector (mode, GetDefaultTxPowerLevel (), GetPreambleForTransmission (mode, GetAddress (station)),
+                       ConvertGuardIntervalToNanoSeconds (mode, GetShortGuardInterval (station), NanoSeconds (GetGuardInterval (station))),
+                       GetNumberOfAntennas (), Min (GetMaxNumberOfTransmitStreams (), GetNumberOfSupportedStreams (station)), 0,
+                       GetChannelWidthForTransmission (mode, GetChannelWidth (station)), GetAggregation (station), false);
+}
+
+WifiTxVector
+DmgSnrWifiManager::DoGetRtsTxVector (WifiRemoteStation *st)
+{
+  NS_LOG_FUNCTION (this << st);
+  return GetDmgControlTxVector ();
+}
+
+bool
+DmgSnrWifiManager::IsLowLatency (void) const
+{
+  return true;
+}
+
+} //namespace ns3
@@ -0,0 +1,126 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2015-2019 IMDEA Networks Institute
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+#ifndef DMG_SNR_WIFI_MANAGER_H
+#define DMG_SNR_WIFI_MANAGER_H
+
+#include "ns3/traced-value.h"
+#include "wifi-remote-station-manager.h"
+
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \brief SNR-driven rate control algorithm for DMG stations
+ * \ingroup wifi
+ *
+ * This class selects the DMG MCS from the SNR of the link with each remote station.
+ * The SNR is seeded by the beamforming training (the best sector found during the SLS
+ * phase or the best AWV found during the BRP phase) and then refined by the data SNR
+ * reported back in the ACK and Block ACK frames.
+ *
+ * At initialization, the error rate model of the PHY (e.g. the DMG error model lookup
+ * table) is used to compute for each DMG SC/OFDM MCS the minimum SNR at which a frame
+ * of the reference size is received with a packet error rate below the target. The
+ * selected MCS is the fastest MCS supported by the remote station whose threshold is
+ * below the current SNR.
+ *
+ * The selection is event-driven: it is cached per remote station together with the SNR
+ * range over which it remains valid, and recomputed only when a reported SNR leaves that
+ * range or when repeated transmission failures step the rate down (consecutive successes
+ * step it back up), so the per-frame cost of the manager is constant.
+ */
+class DmgSnrWifiManager : public WifiRemoteStationManager
+{
+public:
+  static TypeId GetTypeId (void);
+  DmgSnrWifiManager ();
+  virtual ~DmgSnrWifiManager ();
+
+  void SetupPhy (const Ptr<WifiPhy> phy);
+
+
+private:
+  //overriden from base class
+  void DoInitialize (void);
+  WifiRemoteStation* DoCreateStation (void) const;
+  void DoReportRxOk (WifiRemoteStation *station,
+                     double rxSnr, WifiMode txMode);
+  void DoReportRtsFailed (WifiRemoteStation *station);
+  void DoReportDataFailed (WifiRemoteStation *station);
+  void DoReportRtsOk (WifiRemoteStation *station,
+                      double ctsSnr, WifiMode ctsMode, double rtsSnr);
+  void DoReportDataOk (WifiRemoteStation *station,
+                       double ackSnr, WifiMode ackMode, double dataSnr);
+  void DoReportAmpduTxStatus (WifiRemoteStation *station,
+                              uint8_t nSuccessfulMpdus, uint8_t nFailedMpdus,
+                              double rxSnr, double dataSnr);
+  void DoReportBeamformingSnr (WifiRemoteStation *station, double snr);
+  void DoReportFinalRtsFailed (WifiRemoteStation *station);
+  void DoReportFinalDataFailed (WifiRemoteStation *station);
+  WifiTxVector DoGetDataTxVector (WifiRemoteStation *station);
+  WifiTxVector DoGetRtsTxVector (WifiRemoteStation *station);
+  bool IsLowLatency (void) const;
+
+  /**
+   * Record a new SNR value of the link with a remote station.
+   * \param station The remote station.
+   * \param snr The SNR value (linear).
+   */
+  void UpdateSnr (WifiRemoteStation *station, double snr);
+  /**
+   * Record a successful transmission to a remote station.
+   * \param station The remote station.
+   * \param dataSnr The SNR (linear) of the data reported by the remote station, zero if unknown.
+   */
+  void ReportSuccess (WifiRemoteStation *station, double dataSnr);
+  /**
+   * Record a failed transmission to a remote station.
+   * \param station The remote station.
+   */
+  void ReportFailure (WifiRemoteStation *station);
+  /**
+   * Select the MCS of a remote station from its current SNR.
+   * \param station The remote station.
+   */
+  void SelectMode (WifiRemoteStation *station);
+  /**
+   * Compute the minimum SNR needed to receive a frame of the reference size
+   * with the given mode at the target packet error rate.
+   * \param mode The DMG MCS.
+   * \return The minimum SNR (linear) or a negative value if it cannot be reached.
+   */
+  double CalculateSnrThreshold (WifiMode mode) const;
+
+  /**
+   * A candidate DMG MCS for data transmission.
+   */
+  struct Candidate
+  {
+    WifiMode mode;          //!< The DMG MCS.
+    uint64_t dataRate;      //!< The data rate of the MCS (bps).
+    double threshold;       //!< The minimum SNR (linear) to reach the target packet error rate.
+  };
+
+  typedef std::vector<Candidate> Candidates;
+
+  /**
+   * \return True if the first candidate has a lower data rate than the second one.
+   */
+  static bool CompareDataRate (const Candidate &a, const Candidate &b);
+
+  Candidates m_candidates;          //!< Candidate MCSs sorted by increasing data rate.
+  double m_targetPer;               //!< The maximum packet error rate acceptable at any MCS.
+  uint32_t m_referenceFrameSize;    //!< The frame size used to compute the SNR thresholds.
+  uint32_t m_failureThreshold;      //!< The number of consecutive failures before stepping down.
+  uint32_t m_successThreshold;      //!< The number of consecutive successes before stepping back up.
+
+  TracedValue<uint64_t> m_currentRate; //!< Trace rate changes
+};
+
+} //namespace ns3
+
+#endif /* DMG_SNR_WIFI_MANAGER_H */
@@ -14,6 +14,7 @@
 
 #include "amsdu-subframe-header.h"
 #include "dcf-manager.h"
+#include "dmg-abft-contention.h"
 #include "dmg-capabilities.h"
 #include "dmg-sta-wifi-mac.h"
 #include "dmg-wifi-phy.h"
@@ -111,6 +112,12 @@ DmgStaWifiMac::GetTypeId (void)
                    UintegerValue (dot11RSSBackoff),
                    MakeUintegerAccessor (&DmgStaWifiMac::m_rssBackoffLimit),
                    MakeUintegerChecker<uint8_t> (1 ,32))
+    .AddAttribute ("AbftContention", "If set, the contention in the A-BFT SSW slots is resolved logically by this "
+                   "model and only the slots with a single contender are simulated at the PHY level. "
+                   "The same object must be shared by all the DMG STAs contending in the same BSS.",
+                   PointerValue (),
+                   MakePointerAccessor (&DmgStaWifiMac::m_abftContention),
+                   MakePointerChecker<DmgAbftContention> ())
 
     /* Link Maintenance Attributes */
     .AddAttribute ("BeamLinkMaintenanceUnit", "The unit used for dot11BeamLinkMaintenanceTime calculation.",
@@ -278,6 +285,7 @@ void
 DmgStaWifiMac::DoDispose ()
 {
   NS_LOG_FUNCTION (this);
+  m_abftContention = 0;
   DmgWifiMac::DoDispose ();
 }
 
@@ -740,21 +748,10 @@ DmgStaWifiMac::Enqueue (Ptr<const Packet> packet, Mac48Address to)
   hdr.SetQosNoAmsdu ();
   hdr.SetQosRdGrant (m_supportRdp);
 
-  bool found = false;
-  AccessPeriodInformation accessPeriodInfo;
-  for (DataForwardingTableIterator it = m_dataForwardingTable.begin (); it != m_dataForwardingTable.end (); it++)
+  const DmgStationRecord *record = m_stationTable.Find (to);
+  if ((record != 0) && record->hasForwarding && (record->forwarding.nextHopAddress != GetBssid ()))
     {
-      accessPeriodInfo = it->second;
-      if (it->first == to)
-        {
-          found = true;
-          break;
-        }
-    }
-
-  if (found && accessPeriodInfo.nextHopAddress != GetBssid ())
-    {
-      hdr.SetAddr1 (accessPeriodInfo.nextHopAddress);
+      hdr.SetAddr1 (record->forwarding.nextHopAddress);
       hdr.SetAddr2 (GetAddress ());
       hdr.SetAddr3 (GetBssid ());
       hdr.SetDsNotTo ();
@@ -827,18 +824,13 @@ DmgStaWifiMac::CommunicateInServicePeriod (Mac48Address peerAddress)
 {
   NS_LOG_FUNCTION (this << GetAddress () << peerAddress);
   /* The two stations can communicate in TDMA like manner */
-  DataForwardingTableIterator it = m_dataForwardingTable.find (peerAddress);
-  if (it != m_dataForwardingTable.end ())
+  DmgStationRecord &record = m_stationTable.Add (peerAddress);
+  if (!record.hasForwarding)
     {
-      it->second.isCbapPeriod = false;
-    }
-  else
-    {
-      AccessPeriodInformation info;
-      info.isCbapPeriod = false;
-      info.nextHopAddress = peerAddress;
-      m_dataForwardingTable[peerAddress] = info;
+      record.hasForwarding = true;
+      record.forwarding.nextHopAddress = peerAddress;
     }
+  record.forwarding.isCbapPeriod = false;
 }
 
 Ptr<StaAvailabilityElement>
@@ -946,6 +938,85 @@ DmgStaWifiMac::StartBeaconTransmissionInterval (void)
 //    }
 }
 
+void
+DmgStaWifiMac::ReceiveAbstractDmgBeacon (Mac48Address bssid, Ptr<MobilityModel> apMobility, ExtDMGBeacon beacon,
+                                         Time nextAccessPeriod, bool beamformingTraining)
+{
+  NS_LOG_FUNCTION (this << bssid << nextAccessPeriod << beamformingTraining);
+  m_receivedDmgBeacon = true;
+  m_beaconArrival = Simulator::Now ();
+  RestartBeaconWatchdog (MicroSeconds (beacon.GetBeaconIntervalUs () * m_maxLostBeacons));
+
+  /* Beacon Interval Field */
+  ExtDMGBeaconIntervalCtrlField beaconInterval = beacon.GetBeaconIntervalControlField ();
+  m_nextBeacon = beaconInterval.GetNextBeacon ();
+  m_atiPresent = beaconInterval.IsATIPresent ();
+  m_nextAbft = beaconInterval.GetNextABFT ();
+  m_nBI = beaconInterval.GetN_BI ();
+  m_ssSlotsPerABFT = beaconInterval.GetABFT_Length ();
+  m_ssFramesPerSlot = beaconInterval.GetFSS ();
+  m_isResponderTXSS = beaconInterval.IsResponderTXSS ();
+
+  /* DMG Parameters */
+  ExtDMGParameters parameters = beacon.GetDMGParameters ();
+  m_isCbapOnly = parameters.Get_CBAP_Only ();
+  m_isCbapSource = parameters.Get_CBAP_Source ();
+
+  if ((m_state == UNASSOCIATED) && m_atiPresent)
+    {
+      Ptr<NextDmgAti> atiElement = StaticCast<NextDmgAti> (beacon.GetInformationElement (IE_NEXT_DMG_ATI));
+      m_atiDuration = MicroSeconds (atiElement->GetAtiDuration ());
+    }
+
+  /* Record DMG Capabilities */
+  Ptr<DmgCapabilities> capabilities = StaticCast<DmgCapabilities> (beacon.GetInformationElement (IE_DMG_CAPABILITIES));
+  if (capabilities != 0)
+    {
+      DmgStationRecord &record = m_stationTable.Add (bssid);
+      record.hasInformation = true;
+      record.information = StationInformation ();
+      record.information.first = capabilities;
+      m_stationManager->AddStationDmgCapabilities (bssid, capabilities);
+    }
+
+  /* Synchronize with the BSS */
+  m_abftDuration = m_ssSlotsPerABFT * GetSectorSweepSlotTime (m_ssFramesPerSlot);
+  m_biStartTime = MicroSeconds (beacon.GetTimestamp ());
+  m_beaconInterval = MicroSeconds (beacon.GetBeaconIntervalUs ());
+
+  /* Extended Scheudle Element */
+  Ptr<ExtendedScheduleElement> scheduleElement =
+      StaticCast<ExtendedScheduleElement> (beacon.GetInformationElement (IE_EXTENDED_SCHEDULE));
+  if (scheduleElement != 0)
+    {
+      m_allocationList = scheduleElement->GetAllocationFieldList ();
+    }
+
+  /* The beamforming training of the A-BFT is derived from the geometry of the stations */
+  if (m_nextAbft == 0)
+    {
+      SetBssid (bssid);
+      if (beamformingTraining)
+        {
+          m_isBeamformingInitiator = false;
+          m_isInitiatorTXSS = true;
+          CompleteAbstractSectorSweep (bssid, apMobility, CHANNEL_ACCESS_BHI, BeamformingResponder);
+          m_failedRssAttemptsCounter = 0;
+          m_abftState = BEAMFORMING_TRAINING_COMPLETED;
+        }
+    }
+
+  /* Skip the remaining BHI access periods */
+  if (m_atiPresent)
+    {
+      Simulator::Schedule (nextAccessPeriod, &DmgStaWifiMac::StartAnnouncementTransmissionInterval, this);
+    }
+  else
+    {
+      Simulator::Schedule (nextAccessPeriod, &DmgStaWifiMac::StartDataTransmissionInterval, this);
+    }
+}
+
 void
 DmgStaWifiMac::StartAssociationBeamformTraining (void)
 {
@@ -1054,6 +1125,10 @@ DmgStaWifiMac::DoAssociationBeamformingTraining (uint8_t currentSlotIndex)
                     ", Remaining Slots in the current A-BFT=" << uint16_t (m_remainingSlotsPerABFT));
       m_selectedSlotIndex = slotIndex + currentSlotIndex;
       NS_LOG_DEBUG ("Selected Sector Slot Index=" << uint16_t (m_selectedSlotIndex));
+      if (m_abftContention != 0)
+        {
+          m_abftContention->RegisterContender (GetBssid (), m_selectedSlotIndex, m_ssSlotsPerABFT, m_abftDuration);
+        }
     }
 }
 
@@ -1083,6 +1158,14 @@ DmgStaWifiMac::StartAbftResponderSectorSweep (Mac48Address address)
   NS_LOG_FUNCTION (this << address << m_isResponderTXSS);
   if (m_dcfManager->CanAccess ())
     {
+      if ((m_abftContention != 0) && !m_abftContention->ResolveSlot (address, m_selectedSlotIndex))
+        {
+          /* The slot is collided, so skip the transmission of the SSW frames and wait for the
+           * SSW-FBCK timeout as we would do after a collision at the PHY level. */
+          Time timeout = GetSectorSweepSlotTime (m_ssFramesPerSlot) - GetMbifs ();
+          m_sswFbckTimeout = Simulator::Schedule (timeout, &DmgStaWifiMac::MissedSswFeedback, this);
+          return;
+        }
       m_sectorSweepStarted = Simulator::Now ();
       m_sectorSweepDuration = CalculateSectorSweepDuration (m_ssFramesPerSlot);
       /* Obtain antenna configuration for the highest received SNR to feed it back in SSW-FBCK Field */
@@ -1216,7 +1299,7 @@ DmgStaWifiMac::StartDataTransmissionInterval (void)
                   if (field.GetSourceAid () == m_aid)
                     {
                       uint8_t destAid = field.GetDestinationAid ();
-                      Mac48Address destAddress = m_aidMap[destAid];
+                      Mac48Address destAddress = m_stationTable.GetAddress (destAid);
                       if (field.GetBfControl ().IsBeamformTraining ())
                         {
                           Simulator::Schedule (spStart, &DmgStaWifiMac::StartBeamformingTraining, this, destAid, destAddress, true,
@@ -1224,15 +1307,15 @@ DmgStaWifiMac::StartDataTransmissionInterval (void)
                         }
                       else
                         {
-                          DataForwardingTableIterator forwardingIterator = m_dataForwardingTable.find (destAddress);
-                          if (forwardingIterator == m_dataForwardingTable.end ())
+                          DmgStationRecord *record = m_stationTable.Find (destAddress);
+                          if ((record == 0) || !record->hasForwarding)
                             {
                               NS_LOG_ERROR ("Did not perform Beamforming Training with " << destAddress);
                               continue;
                             }
                           else
                             {
-                              forwardingIterator->second.isCbapPeriod = false;
+                              record->forwarding.isCbapPeriod = false;
                             }
                           ScheduleAllocationBlocks (field, SOURCE_STA);
                         }
@@ -1251,7 +1334,7 @@ DmgStaWifiMac::StartDataTransmissionInterval (void)
                        * should be in the receive state for the duration of the SP in order to receive
                        * transmissions from the source DMG STA. */
                       uint8_t sourceAid = field.GetSourceAid ();
-                      Mac48Address sourceAddress = m_aidMap[sourceAid];
+                      Mac48Address sourceAddress = m_stationTable.GetAddress (sourceAid);
                       if (field.GetBfControl ().IsBeamformTraining ())
                         {
                           Simulator::Schedule (spStart, &DmgStaWifiMac::StartBeamformingTraining, this, sourceAid, sourceAddress, false,
@@ -1323,7 +1406,7 @@ DmgStaWifiMac::InitiateAllocationPeriod (AllocationID id, uint8_t srcAid, uint8_
 
   if (role == SOURCE_STA)
     {
-      Mac48Address dstAddress = m_aidMap[dstAid];
+      Mac48Address dstAddress = m_stationTable.GetAddress (dstAid);
       if (protectedAllocation)
         {
           RELAY_LINK_INFO info = it->second;
@@ -1361,7 +1444,7 @@ DmgStaWifiMac::InitiateAllocationPeriod (AllocationID id, uint8_t srcAid, uint8_
     }
   else if (role == DESTINATION_STA)
     {
-      Mac48Address srcAddress = m_aidMap[srcAid];
+      Mac48Address srcAddress = m_stationTable.GetAddress (srcAid);
       if (protectedAllocation)
         {
           RELAY_LINK_INFO info = it->second;
@@ -1550,7 +1633,7 @@ DmgStaWifiMac::RelayLinkChangeIntervalTimeout (void)
                    * Link Change Interval period. */
                   m_relayLinkInfo.relayForwardingActivated = true;
 //                  m_edca[AC_BE]->ChangePacketsAddress (m_relayLinkInfo.dstRedsAddress, m_relayLinkInfo.selectedRelayAddress);
-                  m_dataForwardingTable[m_relayLinkInfo.dstRedsAddress].nextHopAddress = m_relayLinkInfo.selectedRelayAddress;
+                  SetNextHopAddress (m_relayLinkInfo.dstRedsAddress, m_relayLinkInfo.selectedRelayAddress);
                 }
               /* Special case for First Period after link switching */
               StartRelayFirstPeriodAfterSwitching ();
@@ -1617,7 +1700,7 @@ DmgStaWifiMac::StartHalfDuplexRelay (AllocationID allocationID, Time servicePeri
   if ((!m_relayLinkInfo.relayForwardingActivated) && (m_relayLinkInfo.srcRedsAid == m_aid))
     {
       m_relayLinkInfo.relayForwardingActivated = true;
-      m_dataForwardingTable[m_relayLinkInfo.dstRedsAddress].nextHopAddress = m_relayLinkInfo.selectedRelayAddress;
+      SetNextHopAddress (m_relayLinkInfo.dstRedsAddress, m_relayLinkInfo.selectedRelayAddress);
     }
   if (m_relayLinkInfo.transmissionLink == RELAY_LINK)
     {
@@ -1938,7 +2021,7 @@ DmgStaWifiMac::StartChannelQualityMeasurement (Ptr<DirectionalChannelQualityRequ
   if (element->GetMeasurementMethod () == ANIPI)
     {
       /* We steer the antenna towards the peer station as in 10.31.2 IEEE 802.11ad */
-      Mac48Address peerStation = m_aidMap[element->GetAid ()];
+      Mac48Address peerStation = m_stationTable.GetAddress (element->GetAid ());
       SteerAntennaToward (peerStation);
       /* Disable channel access in case (Extra protection) */
       m_edca[AC_BE]->DisableChannelAccess ();
@@ -2093,11 +2176,11 @@ DmgStaWifiMac::StartRelayDiscovery (Mac48Address stationAddress)
 {
   NS_LOG_FUNCTION (this << stationAddress);
   /* Establish Relay with specific DMG STA */
-  InformationMapIterator it = m_informationMap.find (stationAddress);
-  if (it != m_informationMap.end ())
+  const DmgStationRecord *record = m_stationTable.Find (stationAddress);
+  if ((record != 0) && record->hasInformation)
     {
       /* We already have information about the DMG STA */
-      StationInformation info = static_cast<StationInformation> (it->second);
+      StationInformation info = record->information;
       /* Check if the remote DMG STA is Relay Capable */
       Ptr<RelayCapabilitiesElement> capabilitiesElement = StaticCast<RelayCapabilitiesElement> (info.second[IE_RELAY_CAPABILITIES]);
       if (capabilitiesElement != 0)
@@ -2312,7 +2395,7 @@ DmgStaWifiMac::RemoveRelayEntry (uint16_t sourceAid, uint16_t destinationAid)
       if (info.srcRedsAid == m_aid)
         {
           /* Change next hop address for packets */
-          m_dataForwardingTable[info.dstRedsAddress].nextHopAddress = info.dstRedsAddress;
+          SetNextHopAddress (info.dstRedsAddress, info.dstRedsAddress);
         }
       m_relayLinkMap.erase (it);
     }
@@ -2689,7 +2772,7 @@ DmgStaWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
                     GetBestAntennaConfiguration (hdr->GetAddr2 (), true, measuredsnr);
                     snr = -(unsigned int) (4 * (measuredsnr - 19));
                     elem = Create<ExtChannelMeasurementInfo> ();
-                    elem->SetPeerStaAid (m_macMap[hdr->GetAddr2 ()]);
+                    elem->SetPeerStaAid (GetPeerStationAid (hdr->GetAddr2 ()));
                     elem->SetSnr (snr);
                     list.push_back (elem);
                   }
@@ -2757,7 +2840,7 @@ DmgStaWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
 
                 /* Store the AID and address of the source and destination REDS */
                 m_relayLinkInfo.srcRedsAid = requestHdr.GetSourceAid ();
-                m_relayLinkInfo.srcRedsAddress = m_aidMap[m_relayLinkInfo.srcRedsAid];
+                m_relayLinkInfo.srcRedsAddress = m_stationTable.GetAddress (m_relayLinkInfo.srcRedsAid);
                 m_relayLinkInfo.dstRedsAid = requestHdr.GetDestinationAid ();
                 m_relayLinkInfo.tearDownRelayLink = false;
 
@@ -2774,7 +2857,7 @@ DmgStaWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
                     /* We are the selected RDS so resend RLS Request to the Destination REDS */
                     NS_LOG_LOGIC ("Received RLS Request from Source REDS="
                                   << hdr->GetAddr2 () << ", resend RLS Request to Destination REDS");
-                    m_relayLinkInfo.dstRedsAddress = m_aidMap[m_relayLinkInfo.dstRedsAid];
+                    m_relayLinkInfo.dstRedsAddress = m_stationTable.GetAddress (m_relayLinkInfo.dstRedsAid);
                     /* Upon receiving the RLS Request frame, the RDS shall transmit an RLS Request frame to
                      * the destination REDS containing the same information as received within the frame body
                      * of the source REDS’s RLS Request frame. */
@@ -2876,44 +2959,40 @@ DmgStaWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
                 DmgCapabilitiesList dmgCapabilitiesList = responseHdr.GetDmgCapabilitiesList ();
                 for (DmgCapabilitiesListI iter = dmgCapabilitiesList.begin (); iter != dmgCapabilitiesList.end (); iter++)
                   {
-                    InformationMapIterator infoIter = m_informationMap.find ((*iter)->GetStaAddress ());
-                    if (infoIter != m_informationMap.end ())
+                    DmgStationRecord &record = m_stationTable.Add ((*iter)->GetStaAddress ());
+                    if (record.hasInformation)
                       {
-                        StationInformation *information = &(infoIter->second);
-                        information->first = *iter;
+                        record.information.first = *iter;
                       }
                     else
                       {
-                        StationInformation information;
-                        information.first = *iter;
-                        m_informationMap[(*iter)->GetStaAddress ()] = information;
+                        record.hasInformation = true;
+                        record.information.first = *iter;
                         MapAidToMacAddress ((*iter)->GetAID (), (*iter)->GetStaAddress ());
                       }
                   }
 
                 /* Store Information related to the requested IEs */
                 WifiInformationElementMap informationMap = responseHdr.GetListOfInformationElement ();
-                InformationMapIterator infoIter = m_informationMap.find (stationAddress);
                 Ptr<DmgCapabilities> dmgCapabilities = StaticCast<DmgCapabilities> (informationMap[IE_DMG_CAPABILITIES]);
-                if (infoIter != m_informationMap.end ())
+                DmgStationRecord &record = m_stationTable.Add (stationAddress);
+                if (record.hasInformation)
                   {
-                    StationInformation *information = &(infoIter->second);
                     if (dmgCapabilities != 0)
                       {
-                        information->first = dmgCapabilities;
+                        record.information.first = dmgCapabilities;
                       }
-                    information->second = informationMap;
+                    record.information.second = informationMap;
                   }
                 else
                   {
-                    StationInformation information;
+                    record.hasInformation = true;
+                    record.information.second = informationMap;
                     if (dmgCapabilities != 0)
                       {
-                        information.first = dmgCapabilities;
+                        record.information.first = dmgCapabilities;
                         MapAidToMacAddress (dmgCapabilities->GetAID (), dmgCapabilities->GetStaAddress ());
                       }
-                    information.second = informationMap;
-                    m_informationMap[stationAddress] = information;
                   }
 
                 m_informationReceived (stationAddress);
@@ -2974,7 +3053,7 @@ DmgStaWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
           /* We are the responder in the allocated SP */
           peerAid = field.GetSourceAID ();
         }
-      peerAddress = m_aidMap[peerAid];
+      peerAddress = m_stationTable.GetAddress (peerAid);
 
       /** The allocation begins upon successful reception of the Grant frame plus the value from the Duration field
         * of the Grant frame minus the value of the Allocation Duration field of the Grant frame. */
@@ -3013,7 +3092,7 @@ DmgStaWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
           if (!m_receivedDmgBeacon)
             {
               m_receivedDmgBeacon = true;
-              m_stationSnrMap.erase (hdr->GetAddr1 ());
+              ClearSnrTable (hdr->GetAddr1 ());
               m_beaconArrival = Simulator::Now ();
 
               Time delay = MicroSeconds (beacon.GetBeaconIntervalUs () * m_maxLostBeacons);
@@ -3064,9 +3143,10 @@ DmgStaWifiMac::Receive (Ptr<Packet> packet, const WifiMacHeader *hdr)
               Ptr<DmgCapabilities> capabilities = StaticCast<DmgCapabilities> (beacon.GetInformationElement (IE_DMG_CAPABILITIES));
               if (capabilities != 0)
                 {
-                  StationInformation information;
-                  information.first = capabilities;
-                  m_informationMap[hdr->GetAddr1 ()] = information;
+                  DmgStationRecord &record = m_stationTable.Add (hdr->GetAddr1 ());
+                  record.hasInformation = true;
+                  record.information = StationInformation ();
+                  record.information.first = capabilities;
                   m_stationManager->AddStationDmgCapabilities (hdr->GetAddr2 (), capabilities);
                 }
 
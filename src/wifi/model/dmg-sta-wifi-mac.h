@@ -21,6 +21,7 @@
 namespace ns3  {
 
 class UniformRandomVariable;
+class DmgAbftContention;
 
 /**
  * \ingroup wifi
@@ -230,6 +231,23 @@ public:
    * \return true if we are associated with a DMG AP, false otherwise
    */
   bool IsAssociated (void) const;
+  /**
+   * Return whether we have completed beamforming training with an AP.
+   *
+   * \return true if we have completed beamforming training with an AP, false otherwise
+   */
+  bool IsBeamformedTrained (void) const;
+  /**
+   * Receive the content of a DMG Beacon from a DMG PCP/AP abstracting its BHI. The DMG STA
+   * synchronizes with the BSS as if it received the DMG Beacon and skips the BHI access periods.
+   * \param bssid The BSSID of the DMG PCP/AP.
+   * \param apMobility The mobility model of the DMG PCP/AP.
+   * \param beacon The DMG Beacon frame body.
+   * \param nextAccessPeriod The delay until the end of the BHI.
+   * \param beamformingTraining Whether we complete the beamforming training of the A-BFT in this BHI.
+   */
+  void ReceiveAbstractDmgBeacon (Mac48Address bssid, Ptr<MobilityModel> apMobility, ExtDMGBeacon beacon,
+                                 Time nextAccessPeriod, bool beamformingTraining);
 
 protected:
   friend class MultiBandNetDevice;
@@ -493,12 +511,6 @@ private:
    * WAIT_PROBE_RESP and re-send a probe request.
    */
   void ProbeRequestTimeout (void);
-  /**
-   * Return whether we have completed beamforming training with an AP.
-   *
-   * \return true if we have completed beamforming training with an AP, false otherwise
-   */
-  bool IsBeamformedTrained (void) const;
   /**
    * Return whether we are waiting for an association response from an AP.
    *
@@ -603,6 +615,7 @@ private:
   Ptr<UniformRandomVariable> m_rssBackoffVariable;//!< Random variable for the RSS Backoff value.
   bool m_staAvailabilityElement;                //!< Flag to indicate whether we include STA Availability element in DMG Beacon.
   bool m_immediateAbft;                         //!< Flag to indicate if we start A-BFT after receiving fragmented A-BFT.
+  Ptr<DmgAbftContention> m_abftContention;      //!< Logical A-BFT contention model (if any).
 
   /* DMG Relay Support Variables */
   bool m_relayAckRequest;                       //!< Request Relay ACK.
@@ -0,0 +1,257 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2015-2019 IMDEA Networks Institute
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ */
+
+#include "ns3/assert.h"
+#include "ns3/log.h"
+
+#include "dmg-station-table.h"
+
+#include <cstring>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("DmgStationTable");
+
+/* The initial number of hash buckets, must be a power of two */
+#define STATION_TABLE_INITIAL_BUCKETS   16
+
+DmgStationTable::DmgStationTable ()
+  : m_buckets (STATION_TABLE_INITIAL_BUCKETS, 0)
+{
+  std::memset (m_aidIndex, 0, sizeof (m_aidIndex));
+}
+
+uint32_t
+DmgStationTable::Hash (Mac48Address address)
+{
+  uint8_t buffer[6];
+  address.CopyTo (buffer);
+  /* FNV-1a over the six bytes of the address */
+  uint32_t hash = 2166136261u;
+  for (uint8_t i = 0; i < 6; i++)
+    {
+      hash ^= buffer[i];
+      hash *= 16777619u;
+    }
+  return hash;
+}
+
+uint32_t
+DmgStationTable::FindBucket (Mac48Address address) const
+{
+  uint32_t mask = m_buckets.size () - 1;
+  uint32_t bucket = Hash (address) & mask;
+  while ((m_buckets[bucket] != 0) && (m_records[m_buckets[bucket] - 1].address != address))
+    {
+      bucket = (bucket + 1) & mask;
+    }
+  return bucket;
+}
+
+DmgStationRecord *
+DmgStationTable::Find (Mac48Address address)
+{
+  uint16_t entry = m_buckets[FindBucket (address)];
+  return (entry == 0) ? 0 : &m_records[entry - 1];
+}
+
+const DmgStationRecord *
+DmgStationTable::Find (Mac48Address address) const
+{
+  uint16_t entry = m_buckets[FindBucket (address)];
+  return (entry == 0) ? 0 : &m_records[entry - 1];
+}
+
+DmgStationRecord *
+DmgStationTable::FindByAid (uint16_t aid)
+{
+  if ((aid > DMG_STATION_TABLE_MAX_AID) || (m_aidIndex[aid] == 0))
+    {
+      return 0;
+    }
+  return &m_records[m_aidIndex[aid] - 1];
+}
+
+const DmgStationRecord *
+DmgStationTable::FindByAid (uint16_t aid) const
+{
+  if ((aid > DMG_STATION_TABLE_MAX_AID) || (m_aidIndex[aid] == 0))
+    {
+      return 0;
+    }
+  return &m_records[m_aidIndex[aid] - 1];
+}
+
+uint16_t
+DmgStationTable::NewRecord (void)
+{
+  NS_ASSERT_MSG (m_records.size () < 0xFFFF, "Too many stations in the DMG station table");
+  DmgStationRecord record;
+  record.aid = 0;
+  record.hasAddress = false;
+  record.hasAid = false;
+  record.hasInformation = false;
+  record.hasForwarding = false;
+  record.hasLinkMaintenance = false;
+  record.hasSnr = false;
+  record.forwarding.isCbapPeriod = false;
+  record.linkMaintenance.negotiatedValue = 0;
+  record.linkMaintenance.beamLinkMaintenanceTime = 0;
+  m_records.push_back (record);
+  return m_records.size () - 1;
+}
+
+void
+DmgStationTable::InsertAddress (Mac48Address address, uint16_t slot)
+{
+  /* Keep the load factor of the hash table below one half */
+  if (2 * (m_records.size () + 1) > m_buckets.size ())
+    {
+      Rehash ();
+    }
+  m_buckets[FindBucket (address)] = slot + 1;
+  m_records[slot].address = address;
+  m_records[slot].hasAddress = true;
+}
+
+void
+DmgStationTable::Rehash (void)
+{
+  NS_LOG_FUNCTION (this << m_buckets.size ());
+  m_buckets.assign (2 * m_buckets.size (), 0);
+  for (uint32_t slot = 0; slot < m_records.size (); slot++)
+    {
+      if (m_records[slot].hasAddress)
+        {
+          m_buckets[FindBucket (m_records[slot].address)] = slot + 1;
+        }
+    }
+}
+
+DmgStationRecord &
+DmgStationTable::Add (Mac48Address address)
+{
+  uint32_t bucket = FindBucket (address);
+  if (m_buckets[bucket] != 0)
+    {
+      return m_records[m_buckets[bucket] - 1];
+    }
+  uint16_t slot = NewRecord ();
+  InsertAddress (address, slot);
+  return m_records[slot];
+}
+
+DmgStationRecord &
+DmgStationTable::AddByAid (uint16_t aid)
+{
+  NS_ASSERT (aid <= DMG_STATION_TABLE_MAX_AID);
+  if (m_aidIndex[aid] != 0)
+    {
+      return m_records[m_aidIndex[aid] - 1];
+    }
+  uint16_t slot = NewRecord ();
+  m_records[slot].aid = aid;
+  m_records[slot].hasAid = true;
+  m_aidIndex[aid] = slot + 1;
+  return m_records[slot];
+}
+
+void
+DmgStationTable::MapAid (uint16_t aid, Mac48Address address)
+{
+  NS_LOG_FUNCTION (this << aid << address);
+  NS_ASSERT (aid <= DMG_STATION_TABLE_MAX_AID);
+  uint16_t previous = m_aidIndex[aid];
+  if ((previous != 0) && !m_records[previous - 1].hasAddress && (Find (address) == 0))
+    {
+      /* The AID has been used before we learnt the address of the station, adopt the record */
+      InsertAddress (address, previous - 1);
+      return;
+    }
+  DmgStationRecord &record = Add (address);
+  if ((previous != 0) && !m_records[previous - 1].hasAddress)
+    {
+      /* Both the AID and the address have their own records, merge the AID-only state */
+      DmgStationRecord &aidRecord = m_records[previous - 1];
+      if (aidRecord.hasLinkMaintenance)
+        {
+          record.hasLinkMaintenance = true;
+          record.linkMaintenance = aidRecord.linkMaintenance;
+        }
+      aidRecord.hasAid = false;
+      aidRecord.hasLinkMaintenance = false;
+    }
+  else if ((previous != 0) && (m_records[previous - 1].address != address))
+    {
+      m_records[previous - 1].hasAid = false;
+    }
+  record.aid = aid;
+  record.hasAid = true;
+  m_aidIndex[aid] = (&record - &m_records[0]) + 1;
+}
+
+Mac48Address
+DmgStationTable::GetAddress (uint16_t aid) const
+{
+  const DmgStationRecord *record = FindByAid (aid);
+  if ((record == 0) || !record->hasAddress)
+    {
+      return Mac48Address ();
+    }
+  return record->address;
+}
+
+bool
+DmgStationTable::GetAid (Mac48Address address, uint16_t &aid) const
+{
+  const DmgStationRecord *record = Find (address);
+  if ((record == 0) || !record->hasAid)
+    {
+      return false;
+    }
+  aid = record->aid;
+  return true;
+}
+
+uint32_t
+DmgStationTable::GetSize (void) const
+{
+  return m_records.size ();
+}
+
+DmgStationTable::Iterator
+DmgStationTable::Begin (void)
+{
+  return m_records.begin ();
+}
+
+DmgStationTable::Iterator
+DmgStationTable::End (void)
+{
+  return m_records.end ();
+}
+
+DmgStationTable::ConstIterator
+DmgStationTable::Begin (void) const
+{
+  return m_records.begin ();
+}
+
+DmgStationTable::ConstIterator
+DmgStationTable::End (void) const
+{
+  return m_records.end ();
+}
+
+void
+DmgStationTable::Clear (void)
+{
+  m_records.clear ();
+  m_buckets.assign (STATION_TABLE_INITIAL_BUCKETS, 0);
+  std::memset (m_aidIndex, 0, sizeof (m_aidIndex));
+}
+
+} // namespace ns3
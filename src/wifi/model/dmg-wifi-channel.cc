@@ -22,10 +22,14 @@
 #include "ns3/simulator.h"
 #include "ns3/log.h"
 #include "ns3/pointer.h"
+#include "ns3/nstime.h"
+#include "ns3/mpi-interface.h"
+#include "ns3/mpi-receiver.h"
 #include "dmg-wifi-channel.h"
 #include "ns3/propagation-loss-model.h"
 #include "ns3/propagation-delay-model.h"
 #include "wifi-utils.h"
+#include <algorithm>
 #include <fstream>
 
 namespace ns3 {
@@ -49,6 +53,13 @@ DmgWifiChannel::GetTypeId (void)
                    PointerValue (),
                    MakePointerAccessor (&DmgWifiChannel::m_delay),
                    MakePointerChecker<PropagationDelayModel> ())
+    .AddAttribute ("RemoteDelay", "The minimum propagation delay between the nodes of different MPI tasks, "
+                   "used as lookahead by the parallel simulators. Zero to compute it from the positions "
+                   "of the nodes at the start of the simulation, which is only valid if the nodes do not "
+                   "come closer during the simulation.",
+                   TimeValue (Seconds (0)),
+                   MakeTimeAccessor (&DmgWifiChannel::m_remoteDelay),
+                   MakeTimeChecker ())
     /* New trace sources for DMG PLCP */
     .AddTraceSource ("PhyActivityTracker",
                      "Trace source for transmitting/receiving PLCP field (PHY Tracker).",
@@ -61,7 +72,8 @@ DmgWifiChannel::GetTypeId (void)
 DmgWifiChannel::DmgWifiChannel ()
   : m_blockage (0),
     m_packetDropper (0),
-    m_experimentalMode (false)
+    m_experimentalMode (false),
+    m_remoteDelivery (false)
 {
 }
 
@@ -163,7 +175,9 @@ DmgWifiChannel::Send (Ptr<DmgWifiPhy> sender, Ptr<const Packet> packet, double t
   NS_LOG_FUNCTION (this << sender << packet << txPowerDbm << duration.GetSeconds ());
   Ptr<MobilityModel> senderMobility = sender->GetMobility ();
   NS_ASSERT (senderMobility != 0);
-  for (PhyList::const_iterator i = m_phyList.begin (); i != m_phyList.end (); i++)
+  RemoteReceivers remoteReceivers;
+  uint32_t j = 0; /* Phy ID */
+  for (PhyList::const_iterator i = m_phyList.begin (); i != m_phyList.end (); i++, j++)
     {
       if (sender != (*i))
         {
@@ -186,78 +200,126 @@ DmgWifiChannel::Send (Ptr<DmgWifiPhy> sender, Ptr<const Packet> packet, double t
           Ptr<Codebook> senderCodebook = sender->GetCodebook ();
           Ptr<MobilityModel> receiverMobility= (*i)->GetMobility ()->GetObject<MobilityModel> ();
           Time delay = m_delay->GetDelay (senderMobility, receiverMobility);
-          double rxPowerDbm;
           double azimuthTx = CalculateAzimuthAngle (sender_pos, receiverMobility->GetPosition ());
-          double azimuthRx = CalculateAzimuthAngle (receiverMobility->GetPosition (), sender_pos);
           double gtx = senderCodebook->GetTxGainDbi (azimuthTx);        // Sender's antenna gain in dBi.
-          double grx = (*i)->GetCodebook ()->GetRxGainDbi (azimuthRx);  // Receiver's antenna gain in dBi.
 
-          NS_LOG_DEBUG ("POWER: azimuthTx=" << azimuthTx
-                        << ", azimuthRx=" << azimuthRx
-                        << ", txPowerDbm=" << txPowerDbm
-                        << ", RxPower=" << m_loss->CalcRxPower (txPowerDbm, senderMobility, receiverMobility)
-                        << ", Gtx=" << gtx
-                        << ", Grx=" << grx);
+          /* PHY Activity Monitor */
+          RecordPhyActivity (GetNodeId (sender), GetNodeId (*i), duration, txPowerDbm + gtx,
+                             PLCP_80211AD_PREAMBLE_HDR_DATA, TX_ACTIVITY);
 
-          if (m_experimentalMode)
-            {
-              rxPowerDbm = m_receivedSignalStrength[m_currentSignalStrengthIndex];
-            }
-          else
+          /* The receiver is simulated by another MPI task */
+          if (m_remoteDelivery && IsRemote (*i))
             {
-              rxPowerDbm = m_loss->CalcRxPower (txPowerDbm, senderMobility, receiverMobility) + gtx + grx;
+              AddRemoteReceiver (remoteReceivers, *i, j, gtx, delay);
+              continue;
             }
 
-          /* External Attenuator */
-          if ((m_blockage != 0) &&
-              (((m_srcWifiPhy == sender) && (m_dstWifiPhy == (*i))) ||
-               ((m_srcWifiPhy == (*i)) && (m_dstWifiPhy == sender))))
-            {
-              NS_LOG_DEBUG ("Blockage is inserted");
-              rxPowerDbm += m_blockage ();
-            }
+          DeliverPpdu (sender, (*i), packet, txPowerDbm, gtx, duration, delay);
+        }
+    }
 
-          NS_LOG_DEBUG ("propagation: txPower=" << txPowerDbm << "dbm, rxPower=" << rxPowerDbm << "dbm, " <<
-                        "distance=" << senderMobility->GetDistanceFrom (receiverMobility) << "m, delay=" << delay);
-          Ptr<Packet> copy = packet->Copy ();
-          Ptr<NetDevice> dstNetDevice = (*i)->GetDevice ();
-          uint32_t dstNode;
-          if (dstNetDevice == 0)
-            {
-              dstNode = 0xffffffff;
-            }
-          else
-            {
-              dstNode = dstNetDevice->GetNode ()->GetId ();
-            }
+  if (!remoteReceivers.empty ())
+    {
+      DmgRemoteSignalHeader signal;
+      WifiPhyTag phyTag;
+      AmpduTag ampduTag;
+      signal.SetFieldType (PLCP_80211AD_PREAMBLE_HDR_DATA);
+      signal.SetTxPowerDbm (txPowerDbm);
+      signal.SetDuration (duration);
+      packet->PeekPacketTag (phyTag);
+      signal.SetWifiPhyTag (phyTag);
+      if (packet->PeekPacketTag (ampduTag))
+        {
+          signal.SetAmpduTag (ampduTag);
+        }
+      SendToRemoteTasks (sender, packet, signal, remoteReceivers);
+    }
+}
 
-          Simulator::ScheduleWithContext (dstNode,
-                                          delay, &DmgWifiChannel::Receive,
-                                          (*i), copy, rxPowerDbm, duration);
+void
+DmgWifiChannel::DeliverPpdu (Ptr<DmgWifiPhy> sender, Ptr<DmgWifiPhy> receiver, Ptr<const Packet> packet,
+                             double txPowerDbm, double txAntennaGainDbi, Time duration, Time delay) const
+{
+  NS_LOG_FUNCTION (this << sender << receiver << packet << txPowerDbm << txAntennaGainDbi << duration << delay);
+  Ptr<MobilityModel> senderMobility = sender->GetMobility ();
+  Ptr<MobilityModel> receiverMobility = receiver->GetMobility ()->GetObject<MobilityModel> ();
+  double rxPowerDbm;
+  double azimuthRx = CalculateAzimuthAngle (receiverMobility->GetPosition (), senderMobility->GetPosition ());
+  double grx = receiver->GetCodebook ()->GetRxGainDbi (azimuthRx);  // Receiver's antenna gain in dBi.
 
-          /* PHY Activity Monitor */
-          uint32_t srcNode = sender->GetDevice ()->GetNode ()->GetId ();
-          RecordPhyActivity (srcNode, dstNode, duration, txPowerDbm + gtx, PLCP_80211AD_PREAMBLE_HDR_DATA, TX_ACTIVITY);
-          Simulator::Schedule (delay, &DmgWifiChannel::RecordPhyActivity, this,
-                               srcNode, dstNode, duration, rxPowerDbm, PLCP_80211AD_PREAMBLE_HDR_DATA, RX_ACTIVITY);
-        }
+  NS_LOG_DEBUG ("POWER: azimuthRx=" << azimuthRx
+                << ", txPowerDbm=" << txPowerDbm
+                << ", RxPower=" << m_loss->CalcRxPower (txPowerDbm, senderMobility, receiverMobility)
+                << ", Gtx=" << txAntennaGainDbi
+                << ", Grx=" << grx);
+
+  if (m_experimentalMode)
+    {
+      rxPowerDbm = m_receivedSignalStrength[m_currentSignalStrengthIndex];
+    }
+  else
+    {
+      rxPowerDbm = m_loss->CalcRxPower (txPowerDbm, senderMobility, receiverMobility) + txAntennaGainDbi + grx;
+    }
+
+  /* External Attenuator */
+  if ((m_blockage != 0) &&
+      (((m_srcWifiPhy == sender) && (m_dstWifiPhy == receiver)) ||
+       ((m_srcWifiPhy == receiver) && (m_dstWifiPhy == sender))))
+    {
+      NS_LOG_DEBUG ("Blockage is inserted");
+      rxPowerDbm += m_blockage ();
     }
+
+  NS_LOG_DEBUG ("propagation: txPower=" << txPowerDbm << "dbm, rxPower=" << rxPowerDbm << "dbm, " <<
+                "distance=" << senderMobility->GetDistanceFrom (receiverMobility) << "m, delay=" << delay);
+  Ptr<Packet> copy = packet->Copy ();
+  uint32_t dstNode = GetNodeId (receiver);
+  Simulator::ScheduleWithContext (dstNode,
+                                  delay, &DmgWifiChannel::Receive,
+                                  receiver, copy, rxPowerDbm, duration);
+
+  /* PHY Activity Monitor */
+  Simulator::Schedule (delay, &DmgWifiChannel::RecordPhyActivity, this,
+                       GetNodeId (sender), dstNode, duration, rxPowerDbm, PLCP_80211AD_PREAMBLE_HDR_DATA, RX_ACTIVITY);
 }
 
 void
 DmgWifiChannel::SendAgcSubfield (Ptr<DmgWifiPhy> sender, double txPowerDbm, WifiTxVector txVector) const
 {
   NS_LOG_FUNCTION (this << sender << txPowerDbm << txVector);
+  SendSubfield (sender, txPowerDbm, txVector, PLCP_80211AD_AGC_SF);
+}
+
+void
+DmgWifiChannel::SendTrnCeSubfield (Ptr<DmgWifiPhy> sender, double txPowerDbm, WifiTxVector txVector) const
+{
+  NS_LOG_FUNCTION (this << sender << txPowerDbm << txVector);
+  SendSubfield (sender, txPowerDbm, txVector, PLCP_80211AD_TRN_CE_SF);
+}
+
+void
+DmgWifiChannel::SendTrnSubfield (Ptr<DmgWifiPhy> sender, double txPowerDbm, WifiTxVector txVector) const
+{
+  NS_LOG_FUNCTION (this << sender << txPowerDbm << txVector);
+  SendSubfield (sender, txPowerDbm, txVector, PLCP_80211AD_TRN_SF);
+}
+
+void
+DmgWifiChannel::SendSubfield (Ptr<DmgWifiPhy> sender, double txPowerDbm, WifiTxVector txVector,
+                              PLCP_FIELD_TYPE type) const
+{
   Ptr<MobilityModel> senderMobility = sender->GetMobility ()->GetObject<MobilityModel> ();
   NS_ASSERT (senderMobility != 0);
   Ptr<MobilityModel> receiverMobility;
+  RemoteReceivers remoteReceivers;
   uint32_t j = 0; /* Phy ID */
   Time delay; /* Propagation delay of the signal */
   for (PhyList::const_iterator i = m_phyList.begin (); i != m_phyList.end (); i++, j++)
     {
       if (sender != (*i))
         {
-          // For now don't account for inter channel interference.
+          // For now don't account for inter-channel interference.
           if ((*i)->GetChannelNumber () != sender->GetChannelNumber ())
             {
               continue;
@@ -269,112 +331,208 @@ DmgWifiChannel::SendAgcSubfield (Ptr<DmgWifiPhy> sender, double txPowerDbm, Wifi
           double azimuthTx = CalculateAzimuthAngle (senderMobility->GetPosition (), receiverMobility->GetPosition ());
           double gtx = senderCodebook->GetTxGainDbi (azimuthTx);
 
-          Ptr<Object> dstNetDevice = m_phyList[j]->GetDevice ();
-          uint32_t dstNode;	/* Destination node (Receiver) */
-          if (dstNetDevice == 0)
-            {
-              dstNode = 0xffffffff;
-            }
-          else
+          /* PHY Activity Monitor */
+          RecordPhyActivity (GetNodeId (sender), GetNodeId (*i),
+                             GetSubfieldDuration (type), txPowerDbm + gtx, type, TX_ACTIVITY);
+
+          /* The receiver is simulated by another MPI task */
+          if (m_remoteDelivery && IsRemote (*i))
             {
-              dstNode = dstNetDevice->GetObject<NetDevice> ()->GetNode ()->GetId ();
+              AddRemoteReceiver (remoteReceivers, *i, j, gtx, delay);
+              continue;
             }
 
-          /* PHY Activity Monitor */
-          RecordPhyActivity (sender->GetDevice ()->GetNode ()->GetId (), dstNode,
-                             AGC_SF_DURATION, txPowerDbm + gtx, PLCP_80211AD_AGC_SF, TX_ACTIVITY);
-          Simulator::ScheduleWithContext (dstNode, delay, &DmgWifiChannel::ReceiveAgcSubfield, this, j,
-                                          sender, txVector, txPowerDbm, gtx);
+          DeliverSubfield (sender, j, txVector, txPowerDbm, gtx, type, delay);
         }
     }
+
+  if (!remoteReceivers.empty ())
+    {
+      DmgRemoteSignalHeader signal;
+      signal.SetFieldType (type);
+      signal.SetTxPowerDbm (txPowerDbm);
+      signal.SetDuration (GetSubfieldDuration (type));
+      signal.SetWifiPhyTag (WifiPhyTag (txVector, NORMAL_MPDU, 0));
+      SendToRemoteTasks (sender, Create<Packet> (), signal, remoteReceivers);
+    }
 }
 
 void
-DmgWifiChannel::SendTrnCeSubfield (Ptr<DmgWifiPhy> sender, double txPowerDbm, WifiTxVector txVector) const
+DmgWifiChannel::DeliverSubfield (Ptr<DmgWifiPhy> sender, uint32_t j, WifiTxVector txVector,
+                                 double txPowerDbm, double txAntennaGainDbi,
+                                 PLCP_FIELD_TYPE type, Time delay) const
 {
-  NS_LOG_FUNCTION (this << sender << txPowerDbm << txVector);
-  Ptr<MobilityModel> senderMobility = sender->GetMobility ()->GetObject<MobilityModel> ();
-  NS_ASSERT (senderMobility != 0);
-  Ptr<MobilityModel> receiverMobility;
-  uint32_t j = 0; /* Phy ID */
-  Time delay; /* Propagation delay of the signal */
-  for (PhyList::const_iterator i = m_phyList.begin (); i != m_phyList.end (); i++, j++)
+  uint32_t dstNode = GetNodeId (m_phyList[j]); /* Destination node (Receiver) */
+  switch (type)
     {
-      if (sender != (*i))
-        {
-          // For now don't account for inter channel interference.
-          if ((*i)->GetChannelNumber () != sender->GetChannelNumber ())
-            {
-              continue;
-            }
+    case PLCP_80211AD_AGC_SF:
+      Simulator::ScheduleWithContext (dstNode, delay, &DmgWifiChannel::ReceiveAgcSubfield, this, j,
+                                      sender, txVector, txPowerDbm, txAntennaGainDbi);
+      break;
+    case PLCP_80211AD_TRN_CE_SF:
+      Simulator::ScheduleWithContext (dstNode, delay, &DmgWifiChannel::ReceiveTrnCeSubfield, this, j,
+                                      sender, txVector, txPowerDbm, txAntennaGainDbi);
+      break;
+    case PLCP_80211AD_TRN_SF:
+      Simulator::ScheduleWithContext (dstNode, delay, &DmgWifiChannel::ReceiveTrnSubfield, this, j,
+                                      sender, txVector, txPowerDbm, txAntennaGainDbi);
+      break;
+    default:
+      NS_FATAL_ERROR ("Unexpected TRN subfield type " << type);
+    }
+}
 
-          receiverMobility = (*i)->GetMobility ()->GetObject<MobilityModel> ();
-          delay = m_delay->GetDelay (senderMobility, receiverMobility);
-          Ptr<Codebook> senderCodebook = sender->GetCodebook ();
-          double azimuthTx = CalculateAzimuthAngle (senderMobility->GetPosition (), receiverMobility->GetPosition ());
-          double gtx = senderCodebook->GetTxGainDbi (azimuthTx);
+Time
+DmgWifiChannel::GetSubfieldDuration (PLCP_FIELD_TYPE type)
+{
+  switch (type)
+    {
+    case PLCP_80211AD_AGC_SF:
+      return AGC_SF_DURATION;
+    case PLCP_80211AD_TRN_CE_SF:
+      return TRN_CE_DURATION;
+    case PLCP_80211AD_TRN_SF:
+      return TRN_SUBFIELD_DURATION;
+    default:
+      NS_FATAL_ERROR ("Unexpected TRN subfield type " << type);
+      return Seconds (0);
+    }
+}
+
+uint32_t
+DmgWifiChannel::GetNodeId (Ptr<DmgWifiPhy> phy)
+{
+  Ptr<NetDevice> device = phy->GetDevice ();
+  if (device == 0)
+    {
+      return 0xffffffff;
+    }
+  return device->GetNode ()->GetId ();
+}
 
-          Ptr<Object> dstNetDevice = m_phyList[j]->GetDevice ();
-          uint32_t dstNode;	/* Destination node (Receiver) */
-          if (dstNetDevice == 0)
+void
+DmgWifiChannel::EnableRemoteDelivery (Ptr<DmgWifiPhy> phy)
+{
+  NS_LOG_FUNCTION (this << phy);
+  NS_ASSERT_MSG (MpiInterface::IsEnabled (), "The remote delivery requires MPI to be enabled");
+  if (!m_remoteDelivery)
+    {
+      m_remoteDelivery = true;
+      MpiInterface::AddRemoteChannel (this, MakeCallback (&DmgWifiChannel::GetRemoteDelay, this));
+    }
+  Ptr<MpiReceiver> mpiReceiver = CreateObject<MpiReceiver> ();
+  mpiReceiver->SetReceiveCallback (MakeCallback (&DmgWifiChannel::ReceiveFromRemote, this));
+  phy->GetDevice ()->AggregateObject (mpiReceiver);
+}
+
+Time
+DmgWifiChannel::GetRemoteDelay (uint32_t systemId) const
+{
+  NS_LOG_FUNCTION (this << systemId);
+  bool connected = false;
+  Time delay = Time::Max ();
+  for (PhyList::const_iterator i = m_phyList.begin (); i != m_phyList.end (); i++)
+    {
+      if (IsRemote (*i))
+        {
+          continue;
+        }
+      for (PhyList::const_iterator j = m_phyList.begin (); j != m_phyList.end (); j++)
+        {
+          if ((*j)->GetDevice ()->GetNode ()->GetSystemId () != systemId)
             {
-              dstNode = 0xffffffff;
+              continue;
             }
-          else
+          connected = true;
+          if (m_remoteDelay.IsStrictlyPositive ())
             {
-              dstNode = dstNetDevice->GetObject<NetDevice> ()->GetNode ()->GetId ();
+              return m_remoteDelay;
             }
-
-          /* PHY Activity Monitor */
-          RecordPhyActivity (sender->GetDevice ()->GetNode ()->GetId (), dstNode,
-                             TRN_CE_DURATION, txPowerDbm + gtx, PLCP_80211AD_TRN_CE_SF, TX_ACTIVITY);
-          Simulator::ScheduleWithContext (dstNode, delay, &DmgWifiChannel::ReceiveTrnCeSubfield, this, j,
-                                          sender, txVector, txPowerDbm, gtx);
+          delay = std::min (delay, m_delay->GetDelay ((*i)->GetMobility (), (*j)->GetMobility ()));
         }
     }
+  if (!connected)
+    {
+      return Seconds (-1);
+    }
+  NS_ABORT_MSG_IF (delay.IsZero (), "Nodes of different MPI tasks are co-located, set the RemoteDelay attribute");
+  return delay;
+}
+
+bool
+DmgWifiChannel::IsRemote (Ptr<DmgWifiPhy> phy) const
+{
+  return (phy->GetDevice ()->GetNode ()->GetSystemId () != MpiInterface::GetSystemId ());
 }
 
 void
-DmgWifiChannel::SendTrnSubfield (Ptr<DmgWifiPhy> sender, double txPowerDbm, WifiTxVector txVector) const
+DmgWifiChannel::AddRemoteReceiver (RemoteReceivers &receivers, Ptr<DmgWifiPhy> phy, uint32_t j,
+                                   double txAntennaGainDbi, Time delay) const
 {
-  NS_LOG_FUNCTION (this << sender << txPowerDbm << txVector);
-  Ptr<MobilityModel> senderMobility = sender->GetMobility ()->GetObject<MobilityModel> ();
-  NS_ASSERT (senderMobility != 0);
-  Ptr<MobilityModel> receiverMobility;
-  uint32_t j = 0; /* Phy ID */
-  Time delay; /* Propagation delay of the signal */
-  for (PhyList::const_iterator i = m_phyList.begin (); i != m_phyList.end (); i++, j++)
+  DmgRemoteSignalHeader::Receiver receiver;
+  receiver.phyIndex = j;
+  receiver.txAntennaGainDbi = txAntennaGainDbi;
+  receiver.delay = delay;
+  receivers[phy->GetDevice ()->GetNode ()->GetSystemId ()].push_back (receiver);
+}
+
+void
+DmgWifiChannel::SendToRemoteTasks (Ptr<DmgWifiPhy> sender, Ptr<const Packet> packet,
+                                   DmgRemoteSignalHeader &signal, const RemoteReceivers &receivers) const
+{
+  NS_LOG_FUNCTION (this << sender << packet);
+  PhyList::const_iterator it = std::find (m_phyList.begin (), m_phyList.end (), sender);
+  NS_ASSERT (it != m_phyList.end ());
+  signal.SetSenderIndex (std::distance (m_phyList.begin (), it));
+  signal.SetTxTime (Simulator::Now ());
+  for (RemoteReceivers::const_iterator i = receivers.begin (); i != receivers.end (); i++)
     {
-      if (sender != (*i))
+      /* One message per task, addressed to the MpiReceiver of its first receiver */
+      DmgRemoteSignalHeader header = signal;
+      for (DmgRemoteSignalHeader::ReceiverListCI j = i->second.begin (); j != i->second.end (); j++)
         {
-          // For now don't account for inter-channel interference.
-          if ((*i)->GetChannelNumber () != sender->GetChannelNumber ())
-            {
-              continue;
-            }
-
-          receiverMobility = (*i)->GetMobility ()->GetObject<MobilityModel> ();
-          delay = m_delay->GetDelay (senderMobility, receiverMobility);
-          Ptr<Codebook> senderCodebook = sender->GetCodebook ();
-          double azimuthTx = CalculateAzimuthAngle (senderMobility->GetPosition (), receiverMobility->GetPosition ());
-          double gtx = senderCodebook->GetTxGainDbi (azimuthTx);
+          header.AddReceiver (j->phyIndex, j->txAntennaGainDbi, j->delay);
+        }
+      Ptr<NetDevice> device = m_phyList[i->second.front ().phyIndex]->GetDevice ();
+      Ptr<Packet> copy = packet->Copy ();
+      copy->AddHeader (header);
+      NS_LOG_DEBUG ("Forward " << header << " to task " << i->first);
+      MpiInterface::SendPacket (copy, Simulator::Now () + header.GetMinimumDelay (),
+                                device->GetNode ()->GetId (), device->GetIfIndex ());
+    }
+}
 
-          Ptr<Object> dstNetDevice = m_phyList[j]->GetDevice ();
-          uint32_t dstNode;	/* Destination node (Receiver) */
-          if (dstNetDevice == 0)
-            {
-              dstNode = 0xffffffff;
-            }
-          else
-            {
-              dstNode = dstNetDevice->GetObject<NetDevice> ()->GetNode ()->GetId ();
-            }
+void
+DmgWifiChannel::ReceiveFromRemote (Ptr<Packet> packet)
+{
+  NS_LOG_FUNCTION (this << packet);
+  DmgRemoteSignalHeader signal;
+  packet->RemoveHeader (signal);
+  NS_ASSERT (signal.GetSenderIndex () < m_phyList.size ());
+  Ptr<DmgWifiPhy> sender = m_phyList[signal.GetSenderIndex ()];
+  /* The message is delivered after the shortest propagation delay of the signal */
+  Time elapsed = Simulator::Now () - signal.GetTxTime ();
+  WifiPhyTag phyTag = signal.GetWifiPhyTag ();
+  AmpduTag ampduTag;
+  packet->AddPacketTag (phyTag);
+  if (signal.GetAmpduTag (ampduTag))
+    {
+      packet->AddPacketTag (ampduTag);
+    }
 
-          /* PHY Activity Monitor */
-          RecordPhyActivity (sender->GetDevice ()->GetNode ()->GetId (), dstNode,
-                             TRN_SUBFIELD_DURATION, txPowerDbm + gtx, PLCP_80211AD_TRN_SF, TX_ACTIVITY);
-          Simulator::ScheduleWithContext (dstNode, delay, &DmgWifiChannel::ReceiveTrnSubfield, this, j,
-                                          sender, txVector, txPowerDbm, gtx);
+  const DmgRemoteSignalHeader::ReceiverList &receivers = signal.GetReceivers ();
+  for (DmgRemoteSignalHeader::ReceiverListCI i = receivers.begin (); i != receivers.end (); i++)
+    {
+      NS_ASSERT (i->phyIndex < m_phyList.size ());
+      if (signal.GetFieldType () == PLCP_80211AD_PREAMBLE_HDR_DATA)
+        {
+          DeliverPpdu (sender, m_phyList[i->phyIndex], packet, signal.GetTxPowerDbm (),
+                       i->txAntennaGainDbi, signal.GetDuration (), i->delay - elapsed);
+        }
+      else
+        {
+          DeliverSubfield (sender, i->phyIndex, phyTag.GetWifiTxVector (), signal.GetTxPowerDbm (),
+                           i->txAntennaGainDbi, signal.GetFieldType (), i->delay - elapsed);
         }
     }
 }
@@ -22,8 +22,11 @@
 #define DMG_WIFI_CHANNEL_H
 
 #include "ns3/channel.h"
+#include "dmg-remote-signal-header.h"
 #include "dmg-wifi-phy.h"
 
+#include <map>
+
 namespace ns3 {
 
 class NetDevice;
@@ -149,12 +152,114 @@ public:
    * Update current signal strength value
    */
   void UpdateSignalStrengthValue (void);
+  /**
+   * Enable the delivery of the signals to and from the DmgWifiPhy objects
+   * simulated by other MPI tasks.
+   *
+   * All the tasks create the same DmgWifiPhy objects, the objects of the
+   * nodes of the other tasks acting as ghosts: they are never simulated, but
+   * their position is used to compute the propagation of the signals. When
+   * a signal reaches the ghosts of a task, the channel sends a single
+   * message to that task with the transmission parameters and, for each
+   * ghost, the propagation delay and the gain of the transmit antenna.
+   * The channel of the remote task then delivers the signal to its local
+   * DmgWifiPhy objects as if it had been transmitted locally.
+   *
+   * This method is invoked by DmgWifiHelper::Install when MPI is enabled.
+   *
+   * \param phy the DmgWifiPhy to which the messages from the other tasks can be addressed.
+   */
+  void EnableRemoteDelivery (Ptr<DmgWifiPhy> phy);
+  /**
+   * \param systemId the identifier of another MPI task.
+   * \return the minimum propagation delay from the local nodes to the nodes of
+   * the task, or a negative delay if the task has no node on this channel.
+   */
+  Time GetRemoteDelay (uint32_t systemId) const;
 
 private:
   /**
    * A vector of pointers to DmgWifiPhy.
    */
   typedef std::vector<Ptr<DmgWifiPhy> > PhyList;
+  /**
+   * The receivers simulated by other MPI tasks, indexed by task.
+   */
+  typedef std::map<uint32_t, DmgRemoteSignalHeader::ReceiverList> RemoteReceivers;
+
+  /**
+   * Compute the received power of a PPDU and schedule its reception.
+   * \param sender the transmitting DmgWifiPhy.
+   * \param receiver the receiving DmgWifiPhy.
+   * \param packet the packet being sent.
+   * \param txPowerDbm the tx power associated to the packet (dBm).
+   * \param txAntennaGainDbi the gain of the transmit antenna towards the receiver.
+   * \param duration the transmission duration associated with the packet.
+   * \param delay the remaining propagation delay to the receiver.
+   */
+  void DeliverPpdu (Ptr<DmgWifiPhy> sender, Ptr<DmgWifiPhy> receiver, Ptr<const Packet> packet,
+                    double txPowerDbm, double txAntennaGainDbi, Time duration, Time delay) const;
+  /**
+   * Send a subfield of the TRN-Unit to all the DmgWifiPhy objects on the channel.
+   * \param sender the transmitting DmgWifiPhy.
+   * \param txPowerDbm the tx power associated to the subfield (dBm).
+   * \param txVector the TXVECTOR associated to the packet.
+   * \param type the type of the subfield.
+   */
+  void SendSubfield (Ptr<DmgWifiPhy> sender, double txPowerDbm, WifiTxVector txVector,
+                     PLCP_FIELD_TYPE type) const;
+  /**
+   * Schedule the reception of a subfield of the TRN-Unit.
+   * \param sender the transmitting DmgWifiPhy.
+   * \param j index of the receiving DmgWifiPhy in the PHY list.
+   * \param txVector the TXVECTOR associated to the packet.
+   * \param txPowerDbm the tx power associated to the subfield (dBm).
+   * \param txAntennaGainDbi the gain of the transmit antenna towards the receiver.
+   * \param type the type of the subfield.
+   * \param delay the remaining propagation delay to the receiver.
+   */
+  void DeliverSubfield (Ptr<DmgWifiPhy> sender, uint32_t j, WifiTxVector txVector,
+                        double txPowerDbm, double txAntennaGainDbi,
+                        PLCP_FIELD_TYPE type, Time delay) const;
+  /**
+   * \param type the type of the subfield.
+   * \return the duration of the subfield.
+   */
+  static Time GetSubfieldDuration (PLCP_FIELD_TYPE type);
+  /**
+   * \param phy the DmgWifiPhy.
+   * \return the identifier of the node of the DmgWifiPhy.
+   */
+  static uint32_t GetNodeId (Ptr<DmgWifiPhy> phy);
+  /**
+   * \param phy the DmgWifiPhy.
+   * \return true if the DmgWifiPhy is simulated by another MPI task.
+   */
+  bool IsRemote (Ptr<DmgWifiPhy> phy) const;
+  /**
+   * Add a receiver simulated by another MPI task.
+   * \param receivers the receivers of the signal, indexed by task.
+   * \param phy the receiving DmgWifiPhy.
+   * \param j index of the receiving DmgWifiPhy in the PHY list.
+   * \param txAntennaGainDbi the gain of the transmit antenna towards the receiver.
+   * \param delay the propagation delay to the receiver.
+   */
+  void AddRemoteReceiver (RemoteReceivers &receivers, Ptr<DmgWifiPhy> phy, uint32_t j,
+                          double txAntennaGainDbi, Time delay) const;
+  /**
+   * Send a signal to the other MPI tasks which simulate some of its receivers.
+   * \param sender the transmitting DmgWifiPhy.
+   * \param packet the packet being sent.
+   * \param signal the parameters of the signal.
+   * \param receivers the receivers of the signal, indexed by task.
+   */
+  void SendToRemoteTasks (Ptr<DmgWifiPhy> sender, Ptr<const Packet> packet,
+                          DmgRemoteSignalHeader &signal, const RemoteReceivers &receivers) const;
+  /**
+   * Deliver to the local DmgWifiPhy objects a signal transmitted by another MPI task.
+   * \param packet the packet carrying the DmgRemoteSignalHeader.
+   */
+  void ReceiveFromRemote (Ptr<Packet> packet);
 
   /**
    * This method is scheduled by Send for each associated DmgWifiPhy.
@@ -217,6 +322,8 @@ private:
   uint64_t m_currentSignalStrengthIndex;           //!< Index of the current signal strength.
   bool m_experimentalMode;                         //!< Experimental mode used for injecting signal strength values.
   Time m_updateFrequency;                          //!< Update frequency of the results.
+  bool m_remoteDelivery;                           //!< Flag to indicate if some receivers are simulated by other MPI tasks.
+  Time m_remoteDelay;                              //!< The minimum propagation delay to the nodes of other MPI tasks.
 
   /**
    * TracedCallback signature for reporting PHY activities.
@@ -9,6 +9,7 @@
 #include "ns3/simulator.h"
 #include "ns3/pointer.h"
 #include "ns3/boolean.h"
+#include "ns3/mobility-model.h"
 
 #include "dmg-wifi-mac.h"
 #include "dmg-wifi-phy.h"
@@ -170,6 +171,7 @@ DmgWifiMac::DoInitialize (void)
     }
   m_requestedBrpTraining = false;
   StaticCast<DmgWifiPhy> (m_phy)->RegisterReportSnrCallback (MakeCallback (&DmgWifiMac::ReportSnrValue, this));
+  m_slsCompleted.ConnectWithoutContext (MakeCallback (&DmgWifiMac::ReportSlsSnr, this));
   /* At initialization stage, a DMG STA should be in quasi-omni receiving mode */
   m_codebook->SetReceivingInQuasiOmniMode ();
   /* Channel Access Periods */
@@ -277,8 +279,7 @@ void
 DmgWifiMac::MapAidToMacAddress (uint16_t aid, Mac48Address address)
 {
   NS_LOG_FUNCTION (this << aid << address);
-  m_aidMap[aid] = address;
-  m_macMap[address] = aid;
+  m_stationTable.MapAid (aid, address);
 }
 
 Time
@@ -418,10 +419,10 @@ DmgWifiMac::StartServicePeriod (AllocationID allocationID, Time length, uint8_t
       m_edca[AC_BE]->InitiateTransmission ();
     }
   /* Check if we are maintaining the beamformed link during this service period */
-  BeamLinkMaintenanceTableI it = m_beamLinkMaintenanceTable.find (peerAid);
-  if (it != m_beamLinkMaintenanceTable.end ())
+  DmgStationRecord *record = m_stationTable.FindByAid (peerAid);
+  if ((record != 0) && record->hasLinkMaintenance)
     {
-      BeamLinkMaintenanceInfo info = it->second;
+      BeamLinkMaintenanceInfo info = record->linkMaintenance;
       m_currentLinkMaintained = true;
       m_currentBeamLinkMaintenanceInfo = info;
       m_beamLinkMaintenanceTimeout = Simulator::Schedule (MicroSeconds (info.beamLinkMaintenanceTime),
@@ -461,10 +462,8 @@ DmgWifiMac::EndServicePeriod (void)
   /* Check if we have beamlink maintenance timer running */
   if (m_beamLinkMaintenanceTimeout.IsRunning ())
     {
-      BeamLinkMaintenanceTableI it = m_beamLinkMaintenanceTable.find (m_peerStationAid);
-      BeamLinkMaintenanceInfo info = it->second;
+      BeamLinkMaintenanceInfo &info = m_stationTable.AddByAid (m_peerStationAid).linkMaintenance;
       info.beamLinkMaintenanceTime -= m_currentAllocationLength.GetMicroSeconds ();
-      m_beamLinkMaintenanceTable[m_peerStationAid] = info;
       m_beamLinkMaintenanceTimeout.Cancel ();
     }
   m_currentLinkMaintained = false;
@@ -474,16 +473,32 @@ void
 DmgWifiMac::AddForwardingEntry (Mac48Address nextHopAddress)
 {
   NS_LOG_FUNCTION (this << nextHopAddress);
-  DataForwardingTableIterator it = m_dataForwardingTable.find (nextHopAddress);
-  if (it == m_dataForwardingTable.end ())
+  DmgStationRecord &record = m_stationTable.Add (nextHopAddress);
+  if (!record.hasForwarding)
     {
-      AccessPeriodInformation info;
-      info.isCbapPeriod = true;
-      info.nextHopAddress = nextHopAddress;
-      m_dataForwardingTable[nextHopAddress] = info;
+      record.hasForwarding = true;
+      record.forwarding.isCbapPeriod = true;
+      record.forwarding.nextHopAddress = nextHopAddress;
     }
 }
 
+void
+DmgWifiMac::SetNextHopAddress (Mac48Address destination, Mac48Address nextHopAddress)
+{
+  NS_LOG_FUNCTION (this << destination << nextHopAddress);
+  DmgStationRecord &record = m_stationTable.Add (destination);
+  record.hasForwarding = true;
+  record.forwarding.nextHopAddress = nextHopAddress;
+}
+
+uint16_t
+DmgWifiMac::GetPeerStationAid (Mac48Address address) const
+{
+  uint16_t aid = 0;
+  m_stationTable.GetAid (address, aid);
+  return aid;
+}
+
 Time
 DmgWifiMac::GetRemainingAllocationTime (void) const
 {
@@ -540,7 +555,9 @@ DmgWifiMac::RecordBeamformedLinkMaintenanceValue (BF_Link_Maintenance_Field fiel
           maintenanceInfo.beamLinkMaintenanceTime = dot11BeamLinkMaintenanceTime;
           maintenanceInfo.negotiatedValue = dot11BeamLinkMaintenanceTime;
         }
-      m_beamLinkMaintenanceTable[m_peerStationAid] = maintenanceInfo;
+      DmgStationRecord &record = m_stationTable.AddByAid (m_peerStationAid);
+      record.hasLinkMaintenance = true;
+      record.linkMaintenance = maintenanceInfo;
     }
 }
 
@@ -609,7 +626,7 @@ DmgWifiMac::TxssTxopGranted (Mac48Address peerAddress, bool feedback)
               NS_LOG_INFO ("DMG STA Initiating I-TxSS TxOP with " << peerAddress << " at " << Simulator::Now ());
 
               /* Remove current Sector Sweep Information with the station we want to train with */
-              m_stationSnrMap.erase (peerAddress);
+              ClearSnrTable (peerAddress);
 
               StartBeamformingInitiatorPhase ();
             }
@@ -651,7 +668,7 @@ DmgWifiMac::StartBeamformingTraining (uint8_t peerAid, Mac48Address peerAddress,
   m_isResponderTXSS = isResponderTxss;
 
   /* Remove current Sector Sweep Information */
-  m_stationSnrMap.erase (peerAddress);
+  ClearSnrTable (peerAddress);
 
   NS_LOG_INFO ("DMG STA Initiating Beamforming with " << peerAddress << " at " << Simulator::Now ());
   StartBeamformingInitiatorPhase ();
@@ -1178,10 +1195,14 @@ DmgWifiMac::PrintSnrTable (void)
   std::cout << "****************************************************************" << std::endl;
   std::cout << " SNR Dump for Sector Level Sweep for Station: " << GetAddress () << std::endl;
   std::cout << "****************************************************************" << std::endl;
-  for (STATION_SNR_PAIR_MAP_CI it = m_stationSnrMap.begin (); it != m_stationSnrMap.end (); it++)
+  for (DmgStationTable::ConstIterator it = m_stationTable.Begin (); it != m_stationTable.End (); it++)
     {
-      SNR_PAIR snrPair = it->second;
-      std::cout << "Peer DMG STA: " << it->first << std::endl;
+      if (!it->hasSnr)
+        {
+          continue;
+        }
+      const SNR_PAIR &snrPair = it->snr;
+      std::cout << "Peer DMG STA: " << it->address << std::endl;
       std::cout << "***********************************************" << std::endl;
       std::cout << "Tansmit Sector Sweep (TxSS) SNRs: " << std::endl;
       std::cout << "***********************************************" << std::endl;
@@ -1215,45 +1236,30 @@ void
 DmgWifiMac::MapTxSnr (Mac48Address address, SectorID sectorID, AntennaID antennaID, double snr)
 {
   NS_LOG_FUNCTION (this << address << uint16_t (sectorID) << uint16_t (antennaID) << RatioToDb (snr));
-  STATION_SNR_PAIR_MAP_I it = m_stationSnrMap.find (address);
-  if (it != m_stationSnrMap.end ())
-    {
-      SNR_PAIR *snrPair = (SNR_PAIR *) (&it->second);
-      SNR_MAP_TX *snrMap = (SNR_MAP_TX *) (&snrPair->first);
-      ANTENNA_CONFIGURATION config = std::make_pair (sectorID, antennaID);
-      (*snrMap)[config] = snr;
-    }
-  else
-    {
-      ANTENNA_CONFIGURATION config = std::make_pair (sectorID, antennaID);
-      SNR_MAP_TX snrTx;
-      SNR_MAP_RX snrRx;
-      snrTx[config] = snr;
-      SNR_PAIR snrPair = std::make_pair (snrTx, snrRx);
-      m_stationSnrMap[address] = snrPair;
-    }
+  DmgStationRecord &record = m_stationTable.Add (address);
+  record.hasSnr = true;
+  record.snr.first[std::make_pair (sectorID, antennaID)] = snr;
 }
 
 void
 DmgWifiMac::MapRxSnr (Mac48Address address, SectorID sectorID, AntennaID antennaID, double snr)
 {
   NS_LOG_FUNCTION (this << address << uint16_t (sectorID) << uint16_t (antennaID) << snr);
-  STATION_SNR_PAIR_MAP::iterator it = m_stationSnrMap.find (address);
-  if (it != m_stationSnrMap.end ())
-    {
-      SNR_PAIR *snrPair = (SNR_PAIR *) (&it->second);
-      SNR_MAP_RX *snrMap = (SNR_MAP_RX *) (&snrPair->second);
-      ANTENNA_CONFIGURATION config = std::make_pair (sectorID, antennaID);
-      (*snrMap)[config] = snr;
-    }
-  else
+  DmgStationRecord &record = m_stationTable.Add (address);
+  record.hasSnr = true;
+  record.snr.second[std::make_pair (sectorID, antennaID)] = snr;
+}
+
+void
+DmgWifiMac::ClearSnrTable (Mac48Address address)
+{
+  NS_LOG_FUNCTION (this << address);
+  DmgStationRecord *record = m_stationTable.Find (address);
+  if (record != 0)
     {
-      ANTENNA_CONFIGURATION config = std::make_pair (sectorID, antennaID);
-      SNR_MAP_TX snrTx;
-      SNR_MAP_RX snrRx;
-      snrRx[config] = snr;
-      SNR_PAIR snrPair = std::make_pair (snrTx, snrRx);
-      m_stationSnrMap[address] = snrPair;
+      record->snr.first.clear ();
+      record->snr.second.clear ();
+      record->hasSnr = false;
     }
 }
 
@@ -1570,11 +1576,40 @@ DmgWifiMac::ReportSnrValue (AntennaID antennaID, SectorID sectorID, uint8_t trnU
                            << ". Best AWV ID=" << uint16_t (awvID));
             }
 
+          /* The refined beam gives the most recent estimate of the link quality with the peer */
+          m_stationManager->ReportBeamformingSnr (m_peerStation, m_trn2Snr[awvID]);
           m_trn2Snr.clear ();
         }
     }
 }
 
+void
+DmgWifiMac::ReportSlsSnr (Mac48Address address, ChannelAccessPeriod accessPeriod, BeamformingDirection direction,
+                          bool isInitiatorTxss, bool isResponderTxss, SectorID sectorID, AntennaID antennaID)
+{
+  NS_LOG_FUNCTION (this << address << accessPeriod << direction);
+  const DmgStationRecord *record = m_stationTable.Find (address);
+  if ((record == 0) || !record->hasSnr)
+    {
+      return;
+    }
+  /* Both maps hold the SNR of the frames we received from the peer during the sweep, the
+   * best entry is the best estimate of the beamformed link assuming channel reciprocity */
+  double maxSnr = 0;
+  for (SNR_MAP::const_iterator iter = record->snr.first.begin (); iter != record->snr.first.end (); iter++)
+    {
+      maxSnr = std::max (maxSnr, iter->second);
+    }
+  for (SNR_MAP::const_iterator iter = record->snr.second.begin (); iter != record->snr.second.end (); iter++)
+    {
+      maxSnr = std::max (maxSnr, iter->second);
+    }
+  if (maxSnr > 0)
+    {
+      m_stationManager->ReportBeamformingSnr (address, maxSnr);
+    }
+}
+
 void
 DmgWifiMac::InitiateBrpTransaction (Mac48Address receiver, uint8_t L_RX, bool TX_TRN_REQ)
 {
@@ -1706,22 +1741,39 @@ DmgWifiMac::CalculateBeamformingTrainingDuration (uint8_t initiatorSectors, uint
 void
 DmgWifiMac::StorePeerDmgCapabilities (Ptr<DmgWifiMac> wifiMac)
 {
-  StationInformation information;
-  information.first = wifiMac->GetDmgCapabilities ();
-  m_informationMap[wifiMac->GetAddress ()] = information;
+  DmgStationRecord &record = m_stationTable.Add (wifiMac->GetAddress ());
+  record.hasInformation = true;
+  record.information = StationInformation ();
+  record.information.first = wifiMac->GetDmgCapabilities ();
   MapAidToMacAddress (wifiMac->GetAssociationID (), wifiMac->GetAddress ());
 }
 
+void
+DmgWifiMac::CompleteAbstractSectorSweep (Mac48Address peerAddress, Ptr<MobilityModel> peerMobility,
+                                         ChannelAccessPeriod accessPeriod, BeamformingDirection direction)
+{
+  NS_LOG_FUNCTION (this << peerAddress << accessPeriod << direction);
+  double azimuth = CalculateAzimuthAngle (m_phy->GetMobility ()->GetPosition (), peerMobility->GetPosition ());
+  SectorID sectorID;
+  AntennaID antennaID;
+  double gain = m_codebook->GetBestTxSector (azimuth, sectorID, antennaID);
+  NS_LOG_DEBUG ("Best Tx Antenna Config toward " << peerAddress << ": SectorID=" << static_cast<uint16_t> (sectorID)
+                << ", AntennaID=" << static_cast<uint16_t> (antennaID) << ", Gain=" << gain << " dBi");
+  UpdateBestTxAntennaConfiguration (peerAddress, std::make_pair (sectorID, antennaID));
+  /* We add the station to the list of the stations we can directly communicate with */
+  AddForwardingEntry (peerAddress);
+  m_slsCompleted (peerAddress, accessPeriod, direction, true, true, sectorID, antennaID);
+}
+
 Ptr<DmgCapabilities>
 DmgWifiMac::GetPeerStationDmgCapabilities (Mac48Address stationAddress) const
 {
   NS_LOG_FUNCTION (this << stationAddress);
-  InformationMapCI it = m_informationMap.find (stationAddress);
-  if (it != m_informationMap.end ())
+  const DmgStationRecord *record = m_stationTable.Find (stationAddress);
+  if ((record != 0) && record->hasInformation)
     {
       /* We already have information about the DMG STA */
-      StationInformation info = static_cast<StationInformation> (it->second);
-      return static_cast<Ptr<DmgCapabilities> > (info.first);
+      return record->information.first;
     }
   else
     {
@@ -1852,20 +1904,12 @@ DmgWifiMac::GetBestAntennaConfiguration (const Mac48Address stationAddress, bool
 ANTENNA_CONFIGURATION
 DmgWifiMac::GetBestAntennaConfiguration (const Mac48Address stationAddress, bool isTxConfiguration, double &maxSnr)
 {
-  SNR_PAIR snrPair = m_stationSnrMap [stationAddress];
-  SNR_MAP snrMap;
-  if (isTxConfiguration)
-    {
-      snrMap = snrPair.first;
-    }
-  else
-    {
-      snrMap = snrPair.second;
-    }
+  const SNR_PAIR &snrPair = m_stationTable.Add (stationAddress).snr;
+  const SNR_MAP &snrMap = isTxConfiguration ? snrPair.first : snrPair.second;
 
-  SNR_MAP::iterator highIter = snrMap.begin ();
+  SNR_MAP::const_iterator highIter = snrMap.begin ();
   SNR snr = highIter->second;
-  for (SNR_MAP::iterator iter = snrMap.begin (); iter != snrMap.end (); iter++)
+  for (SNR_MAP::const_iterator iter = snrMap.begin (); iter != snrMap.end (); iter++)
     {
       if (snr < iter->second)
         {
@@ -1934,7 +1978,7 @@ DmgWifiMac::ReceiveSectorSweepFrame (Ptr<Packet> packet, const WifiMacHeader *hd
               m_rssEvent = Simulator::Schedule (rssTime, &DmgWifiMac::StartTxssTxop, this, hdr->GetAddr2 (), false);
 
               /* Remove current Sector Sweep Information with the station we want to train with */
-              m_stationSnrMap.erase (hdr->GetAddr2 ());
+              ClearSnrTable (hdr->GetAddr2 ());
 
               NS_LOG_LOGIC ("Initiate TxSS TxOP for Responder=" << GetAddress () << " at " << Simulator::Now () + rssTime);
             }
@@ -11,6 +11,7 @@
 #include "dmg-sls-dca.h"
 #include "dmg-capabilities.h"
 #include "codebook.h"
+#include "dmg-station-table.h"
 
 namespace ns3 {
 
@@ -60,7 +61,6 @@ enum ChannelAccessPeriod {
 typedef std::pair<DynamicAllocationInfoField, BF_Control_Field> AllocationData; /* Typedef for dynamic allocation of SPs */
 typedef std::list<AllocationData> AllocationDataList;
 typedef AllocationDataList::const_iterator AllocationDataListCI;
-typedef std::pair<SectorID, AntennaID>        ANTENNA_CONFIGURATION;            /* Typedef for antenna Config (SectorID, AntennaID) */
 
 class BeamRefinementElement;
 
@@ -170,6 +170,16 @@ public:
    * \param wifiMac Pointer to the DMG STA.
    */
   void StorePeerDmgCapabilities (Ptr<DmgWifiMac> wifiMac);
+  /**
+   * Complete a Sector Level Sweep with a peer station without exchanging any frame. The best
+   * transmit sector toward the peer station is derived from the geometry and our codebook.
+   * \param peerAddress The MAC address of the peer station.
+   * \param peerMobility The mobility model of the peer station.
+   * \param accessPeriod The access period in which the beamforming training takes place.
+   * \param direction Our role in the beamforming training.
+   */
+  void CompleteAbstractSectorSweep (Mac48Address peerAddress, Ptr<MobilityModel> peerMobility,
+                                    ChannelAccessPeriod accessPeriod, BeamformingDirection direction);
   /**
    * Retreive the DMG Capbilities of a peer DMG station.
    * \param stationAddress The MAC address of the peer station.
@@ -484,9 +494,6 @@ protected:
   typedef SNR_MAP                               SNR_MAP_TX;             /* Typedef for SNR TX for each antenna configuration. */
   typedef SNR_MAP                               SNR_MAP_RX;             /* Typedef for SNR RX for each antenna configuration. */
   typedef std::pair<SNR_MAP_TX, SNR_MAP_RX>     SNR_PAIR;               /* Typedef for SNR RX for each antenna configuration. */
-  typedef std::map<Mac48Address, SNR_PAIR>      STATION_SNR_PAIR_MAP;   /* Typedef for Map between stations and their SNR Table. */
-  typedef STATION_SNR_PAIR_MAP::iterator        STATION_SNR_PAIR_MAP_I; /* Typedef for iterator over SNR MAPPING Table. */
-  typedef STATION_SNR_PAIR_MAP::const_iterator  STATION_SNR_PAIR_MAP_CI;/* Typedef for const iterator over SNR MAPPING Table. */
 
   /* Typedefs for Recording Best Antenna Configuration per Station */
   typedef ANTENNA_CONFIGURATION ANTENNA_CONFIGURATION_TX;               /* Typedef for best TX antenna configuration. */
@@ -521,6 +528,11 @@ protected:
    * \param snrMap The SNR Map
    */
   void PrintSnrConfiguration (SNR_MAP snrMap);
+  /**
+   * Remove the SNR measurements recorded for a peer station before starting a new beamforming training.
+   * \param address The MAC address of the peer station.
+   */
+  void ClearSnrTable (Mac48Address address);
   /**
    * Obtain antenna configuration for the highest received SNR to feed it back
    * \param stationAddress The MAC address of the station.
@@ -631,6 +643,17 @@ protected:
    * \param nextHopAddress The MAC Address of the next hop.
    */
   void AddForwardingEntry (Mac48Address nextHopAddress);
+  /**
+   * Change the next hop used to forward data frames towards a destination.
+   * \param destination The MAC Address of the destination.
+   * \param nextHopAddress The MAC Address of the next hop.
+   */
+  void SetNextHopAddress (Mac48Address destination, Mac48Address nextHopAddress);
+  /**
+   * \param address The MAC Address of the peer station.
+   * \return The AID of the peer station or zero if it is unknown.
+   */
+  uint16_t GetPeerStationAid (Mac48Address address) const;
   /**
    * This function is excuted upon the transmission of frame.
    * \param hdr The header of the transmitted frame.
@@ -667,7 +690,7 @@ protected:
   void AddMcsSupport (Mac48Address address, uint32_t initialMcs, uint32_t lastMcs);
 
 protected:
-  STATION_SNR_PAIR_MAP m_stationSnrMap;           //!< Map between stations and their SNR Table.
+  DmgStationTable m_stationTable;                 //!< Per-station state: AID, capabilities, SNR, forwarding and link maintenance.
   STATION_ANTENNA_CONFIG_MAP m_bestAntennaConfig; //!< Map between remote stations and the best antenna configuration.
   ANTENNA_CONFIGURATION m_feedbackAntennaConfig;  //!< Temporary variable to save the best antenna config of the peer station.
 
@@ -751,11 +774,6 @@ protected:
 
   /* Information Request/Response */
   typedef std::vector<Ptr<WifiInformationElement> > WifiInformationElementList;
-  typedef std::pair<Ptr<DmgCapabilities>, WifiInformationElementMap> StationInformation;
-  typedef std::map<Mac48Address, StationInformation> InformationMap;
-  typedef InformationMap::iterator InformationMapIterator;
-  typedef InformationMap::const_iterator InformationMapCI;
-  InformationMap m_informationMap;              //!< List of information element for assoicated stations.
 
   /* DMG Parameteres */
   bool m_isCbapOnly;                            //!< Flag to indicate whether the DTI is allocated to CBAP.
@@ -815,14 +833,6 @@ protected:
   uint8_t m_beamlinkMaintenanceValue;                       //!< Link maintenance timer value in MicroSeconds.
   uint32_t dot11BeamLinkMaintenanceTime;                    //!< Link maintenance timer in MicroSeconds.
 
-  struct BeamLinkMaintenanceInfo {
-    uint32_t negotiatedValue;                               //!< Negotiated link maintenance value.
-    uint32_t beamLinkMaintenanceTime;
-  };                                                        //!< Typedef for Link Maintenance Information.
-
-  typedef std::map<uint8_t, BeamLinkMaintenanceInfo> BeamLinkMaintenanceTable;
-  typedef BeamLinkMaintenanceTable::iterator BeamLinkMaintenanceTableI;
-  BeamLinkMaintenanceTable m_beamLinkMaintenanceTable;
   EventId m_beamLinkMaintenanceTimeout;         //!< Event ID related to the timer assoicated to the current beamformed link.
   bool m_currentLinkMaintained;                 //!< Flag to indicate whether the current beamformed link is maintained.
   BeamLinkMaintenanceInfo m_currentBeamLinkMaintenanceInfo;
@@ -845,24 +855,6 @@ protected:
   TRN2SNR m_trn2Snr;                                    //!< Variable to store SNR per TRN subfield for ongoing beam refinement phase or beam tracking.
   TRN2SNR_MAP m_trn2snrMap;                             //!< Variable to store SNR vector for TRN Subfields per device.
 
-  /* AID to MAC Address mapping */
-  typedef std::map<uint16_t, Mac48Address> AID_MAP;
-  typedef std::map<Mac48Address, uint16_t> MAC_MAP;
-  typedef AID_MAP::const_iterator AID_MAP_CI;
-  typedef MAC_MAP::const_iterator MAC_MAP_CI;
-  AID_MAP m_aidMap;                                     //!< Map AID to MAC Address.
-  MAC_MAP m_macMap;                                     //!< Map MAC Address to AID.
-
-  /* Data Forwarding Table */
-  typedef struct {
-    Mac48Address nextHopAddress;
-    bool isCbapPeriod;
-  } AccessPeriodInformation;
-
-  typedef std::map<Mac48Address, AccessPeriodInformation> DataForwardingTable;
-  typedef DataForwardingTable::iterator DataForwardingTableIterator;
-  typedef DataForwardingTable::const_iterator DataForwardingTableCI;
-  DataForwardingTable m_dataForwardingTable;
 
   /**
    * TracedCallback signature for service period initiation/termination.
@@ -897,6 +889,19 @@ private:
   void ReportSnrValue (AntennaID antennaID, SectorID sectorID,
                        uint8_t trnUnitsRemaining, uint8_t subfieldsRemaining,
                        double snr, bool isTxTrn);
+  /**
+   * Report the SNR of the best antenna configuration measured during the SLS phase with
+   * a peer station to the remote station manager, this is hooked to our SLSCompleted trace.
+   * \param address The MAC address of the peer station.
+   * \param accessPeriod The access period during which the SLS phase took place.
+   * \param direction The beamforming direction of this station.
+   * \param isInitiatorTxss Flag to indicate if the initiator used TXSS.
+   * \param isResponderTxss Flag to indicate if the responder used TXSS.
+   * \param sectorID The ID of the selected sector.
+   * \param antennaID The ID of the selected antenna.
+   */
+  void ReportSlsSnr (Mac48Address address, ChannelAccessPeriod accessPeriod, BeamformingDirection direction,
+                     bool isInitiatorTxss, bool isResponderTxss, SectorID sectorID, AntennaID antennaID);
 
   Mac48Address m_peerStation;     /* The address of the station we are waiting BRP Response from */
   uint8_t m_dialogToken;          /* The token of the current dialog */
@@ -31,6 +31,8 @@
 #include "ns3/log.h"
 #include "ns3/simulator.h"
 
+#include <limits>
+
 namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("DmgWifiPhy");
@@ -61,6 +63,11 @@ DmgWifiPhy::DmgWifiPhy ()
   NS_LOG_FUNCTION (this);
   m_rdsActivated = false;
   m_lastTxDuration = NanoSeconds (0.0);
+  for (uint32_t i = 0; i < TX_DURATION_CACHE_SIZE; i++)
+    {
+      m_txDurationCache[i].key = std::numeric_limits<uint64_t>::max ();
+    }
+  PrecomputeControlFrameDurations ();
 }
 
 DmgWifiPhy::~DmgWifiPhy ()
@@ -1124,6 +1131,55 @@ DmgWifiPhy::GetPayloadDuration (uint32_t size, WifiTxVector txVector, uint16_t f
     }
 }
 
+void
+DmgWifiPhy::PrecomputeControlFrameDurations (void)
+{
+  NS_LOG_FUNCTION (this);
+  WifiTxVector txVector;
+  txVector.SetMode (GetDMG_MCS0 ());
+  txVector.SetPreambleType (WIFI_PREAMBLE_DMG_CTRL);
+  for (uint32_t size = 0; size < CTRL_DURATION_TABLE_SIZE; size++)
+    {
+      if (size < CTRL_FRAME_MIN_SIZE)
+        {
+          m_ctrlFrameDuration[size] = Seconds (0);
+        }
+      else
+        {
+          m_ctrlFrameDuration[size] = WifiPhy::CalculateTxDuration (size, txVector, 0, NORMAL_MPDU, 0);
+        }
+    }
+}
+
+uint64_t
+DmgWifiPhy::GetTxDurationKey (uint32_t size, WifiTxVector txVector)
+{
+  /* The DMG PPDU duration does not depend on the frequency nor on the type of the MPDU */
+  return uint64_t (size)
+         | (uint64_t (txVector.GetMode ().GetUid () & 0xffff) << 32)
+         | (uint64_t (txVector.GetPreambleType ()) << 48)
+         | (uint64_t (txVector.GetTrainngFieldLength ()) << 56);
+}
+
+Time
+DmgWifiPhy::CalculateTxDuration (uint32_t size, WifiTxVector txVector, uint16_t frequency, MpduType mpdutype, uint8_t incFlag)
+{
+  if ((txVector.GetPreambleType () == WIFI_PREAMBLE_DMG_CTRL) && (txVector.GetTrainngFieldLength () == 0)
+      && (size >= CTRL_FRAME_MIN_SIZE) && (size < CTRL_DURATION_TABLE_SIZE)
+      && (txVector.GetMode ().GetModulationClass () == WIFI_MOD_CLASS_DMG_CTRL))
+    {
+      return m_ctrlFrameDuration[size];
+    }
+  uint64_t key = GetTxDurationKey (size, txVector);
+  TxDurationEntry &entry = m_txDurationCache[((key * 0x9E3779B97F4A7C15ULL) >> 32) & (TX_DURATION_CACHE_SIZE - 1)];
+  if (entry.key != key)
+    {
+      entry.key = key;
+      entry.duration = WifiPhy::CalculateTxDuration (size, txVector, frequency, mpdutype, incFlag);
+    }
+  return entry.duration;
+}
+
 void
 DmgWifiPhy::DoConfigureStandard (void)
 {
@@ -42,6 +42,11 @@ class DmgWifiChannel;
 #define TRN_SUBFIELD_DURATION NanoSeconds (364)     /* TRN Subfield Duration. */
 #define TRN_UNIT_SIZE         4                     /* The number of TRN Subfield within TRN Unit. */
 
+/* TX Duration Cache Parameters */
+#define TX_DURATION_CACHE_SIZE      256             /* The number of entries in the TX duration cache (Power of two). */
+#define CTRL_DURATION_TABLE_SIZE    128             /* Control PHY frames shorter than this have a precomputed duration. */
+#define CTRL_FRAME_MIN_SIZE         14              /* The size of the shortest control frame (ACK frame). */
+
 typedef uint8_t TimeBlockMeasurement;               /* Typedef for Time Block Measurement for SPSH. */
 typedef std::list<TimeBlockMeasurement> TimeBlockMeasurementList; /* Typedef for List of Time Block Measurements. */
 typedef TimeBlockMeasurementList::const_iterator TimeBlockMeasurementListCI;
@@ -266,6 +271,23 @@ public:
    * \return the duration of the PLCP preamble
    */
   virtual Time GetPlcpPreambleDuration (WifiTxVector txVector);
+  using WifiPhy::CalculateTxDuration;
+  /**
+   * Return the total duration of a DMG PPDU. The DMG duration depends only on the size of
+   * the PSDU, the MCS, the preamble type and the length of the TRN field, so the result
+   * is memoized: control PHY frames without TRN field (SSW, SSW-FBCK, SSW-ACK, BRP, RTS,
+   * DMG CTS and ACK) are read from a table precomputed at construction, and any other
+   * frame is looked up in a direct-mapped cache indexed by these parameters.
+   *
+   * \param size the number of bytes in the packet to send
+   * \param txVector the TXVECTOR used for the transmission of this packet
+   * \param frequency the channel center frequency (MHz)
+   * \param mpdutype the type of the MPDU as defined in WifiPhy::MpduType.
+   * \param incFlag this flag is used to indicate that the static variables need to be update or not. This function is called a couple of times for the same packet so static variables should not be increased each time.
+   *
+   * \return the total amount of time this PHY will stay busy for the transmission of these bytes.
+   */
+  virtual Time CalculateTxDuration (uint32_t size, WifiTxVector txVector, uint16_t frequency, MpduType mpdutype, uint8_t incFlag);
   /**
    * \param size the number of bytes in the packet to send
    * \param txVector the TXVECTOR used for the transmission of this packet
@@ -562,6 +584,25 @@ private:
 
   virtual void MeasurementUnitEnded (void);
   virtual void EndMeasurement (void);
+  /**
+   * Fill the table of the control PHY frame durations.
+   */
+  void PrecomputeControlFrameDurations (void);
+  /**
+   * \param size the number of bytes in the PSDU
+   * \param txVector the TXVECTOR used for the transmission of the PSDU
+   * \return the key of the TX duration cache for these parameters.
+   */
+  static uint64_t GetTxDurationKey (uint32_t size, WifiTxVector txVector);
+
+  /**
+   * Entry of the TX duration cache.
+   */
+  struct TxDurationEntry
+  {
+    uint64_t key;           //!< The key of the cached duration.
+    Time duration;          //!< The total duration of the PPDU.
+  };
 
 private:
   Ptr<DmgWifiChannel> m_channel;        //!< DmgWifiChannel that this DmgWifiPhy is connected to
@@ -586,6 +627,9 @@ private:
   bool m_supportLpSc;                   //!< Flag to indicate whether we support LP-SC PHY layer.
   /* Channel measurements */
   uint8_t m_lastRcpiValue;              //!< The Received channel power indicator (RCPI) value of the last received packet.
+  /* TX Duration Cache */
+  TxDurationEntry m_txDurationCache[TX_DURATION_CACHE_SIZE];     //!< Cache of the recently calculated PPDU durations.
+  Time m_ctrlFrameDuration[CTRL_DURATION_TABLE_SIZE];            //!< Precomputed durations of the control PHY frames.
 
 };
 
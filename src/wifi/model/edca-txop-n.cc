@@ -124,6 +124,13 @@ EdcaTxopN::CopyBlockAckAgreements (Mac48Address recipient, Ptr<EdcaTxopN> target
   m_baManager->CopyAgreements (recipient, target->m_baManager);
 }
 
+void
+EdcaTxopN::TransferBlockAckAgreements (Mac48Address recipient, Ptr<EdcaTxopN> target)
+{
+  NS_LOG_FUNCTION (this << recipient << target);
+  m_baManager->TransferAgreements (recipient, target->m_baManager);
+}
+
 void
 EdcaTxopN::SetWifiRemoteStationManager (const Ptr<WifiRemoteStationManager> remoteManager)
 {
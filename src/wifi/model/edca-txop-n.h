@@ -132,6 +132,12 @@ public:
    * \param target
    */
   void CopyBlockAckAgreements (Mac48Address recipient, Ptr<EdcaTxopN> target);
+  /**
+   * Move the established BlockAck agreements and the unacknowledged MPDUs to another EDCAF.
+   * \param recipient The address of the peer station.
+   * \param target The EDCAF of the technology taking over the session.
+   */
+  void TransferBlockAckAgreements (Mac48Address recipient, Ptr<EdcaTxopN> target);
 
   /* dcf notifications forwarded here */
   /**
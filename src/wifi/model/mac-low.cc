@@ -98,6 +98,63 @@ private:
   ns3::MacLow *m_macLow; ///< the MAC
 };
 
+/* The smallest number of slots of a reorder buffer, must be a power of two */
+#define RX_WINDOW_MIN_SLOTS   64
+
+MacLow::RxWindow::RxWindow ()
+  : base (0),
+    count (0)
+{
+}
+
+void
+MacLow::RxWindow::Init (uint16_t startingSeq, uint16_t bufferSize)
+{
+  uint16_t size = RX_WINDOW_MIN_SLOTS;
+  while (size < bufferSize)
+    {
+      size *= 2;
+    }
+  slots.assign (size, BufferedPackets ());
+  presentBitmap.assign (size / 64, 0);
+  base = startingSeq;
+  count = 0;
+}
+
+uint16_t
+MacLow::RxWindow::GetOffset (uint16_t seq) const
+{
+  return (seq - base + 4096) % 4096;
+}
+
+bool
+MacLow::RxWindow::IsPresent (uint16_t seq) const
+{
+  uint16_t index = seq & (slots.size () - 1);
+  return ((presentBitmap[index / 64] >> (index % 64)) & 1) == 1;
+}
+
+void
+MacLow::RxWindow::SetPresent (uint16_t seq, bool present)
+{
+  uint16_t index = seq & (slots.size () - 1);
+  if (present)
+    {
+      presentBitmap[index / 64] |= (uint64_t (1) << (index % 64));
+      count++;
+    }
+  else
+    {
+      presentBitmap[index / 64] &= ~(uint64_t (1) << (index % 64));
+      count--;
+    }
+}
+
+MacLow::BufferedPackets &
+MacLow::RxWindow::GetSlot (uint16_t seq)
+{
+  return slots[seq & (slots.size () - 1)];
+}
 
 MacLow::MacLow ()
   : m_normalAckTimeoutEvent (),
@@ -117,6 +174,7 @@ MacLow::MacLow ()
     m_lastNavDuration (Seconds (0)),
     m_promisc (false),
     m_ampdu (false),
+    m_ampduByteBudget (0),
     m_phyMacLowListener (0),
     m_ctsToSelfSupported (false),
     m_mac (0),
@@ -1734,10 +1792,20 @@ MacLow::ForwardDown (Ptr<const Packet> packet, const WifiMacHeader* hdr, WifiTxV
       WifiPreamble preamble = txVector.GetPreambleType ();
       SubMpduInfo info;
 
-      /* Calculate data part duration only for DMG */
-      txVector.SetPreambleType (WIFI_PREAMBLE_NONE);
-      Time ampduDuration = m_phy->CalculateTxDuration (packet->GetSize (), txVector, m_phy->GetFrequency ());
-      txVector.SetPreambleType (preamble);
+      /* Calculate the duration of the data part of the A-MPDU */
+      Time ampduDuration;
+      if (m_phy->GetStandard () == WIFI_PHY_STANDARD_80211ad)
+        {
+          txVector.SetPreambleType (WIFI_PREAMBLE_NONE);
+          ampduDuration = m_phy->CalculateTxDuration (packet->GetSize (), txVector, m_phy->GetFrequency ());
+          txVector.SetPreambleType (preamble);
+        }
+      else
+        {
+          /* HT/VHT PHYs only accept a PPDU without preamble as part of an aggregate */
+          ampduDuration = m_phy->CalculateTxDuration (packet->GetSize (), txVector, m_phy->GetFrequency ())
+            - m_phy->CalculatePlcpPreambleAndHeaderDuration (txVector);
+        }
       NS_LOG_DEBUG ("A-MPDU Data Duration=" << ampduDuration << ", Size=" << packet->GetSize ()
                     << ", QueueSize=" << queueSize);
 
@@ -2552,17 +2620,48 @@ MacLow::StoreMpduIfNeeded (Ptr<Packet> packet, WifiMacHeader hdr)
     {
       WifiMacTrailer fcs;
       packet->RemoveTrailer (fcs);
-      BufferedPacket bufferedPacket (packet, hdr);
-
-      uint16_t endSequence = ((*it).second.first.GetStartingSequence () + 2047) % 4096;
-      uint32_t mappedSeqControl = QosUtilsMapSeqControlToUniqueInteger (hdr.GetSequenceControl (), endSequence);
 
-      BufferedPacketI i = (*it).second.second.begin ();
-      for (; i != (*it).second.second.end ()
-           && QosUtilsMapSeqControlToUniqueInteger ((*i).second.GetSequenceControl (), endSequence) < mappedSeqControl; i++)
+      RxWindow &window = it->second.second;
+      uint16_t seq = hdr.GetSequenceNumber ();
+      uint16_t size = window.slots.size ();
+      if (window.GetOffset (seq) >= 2048)
+        {
+          /* Older MSDUs have already been forwarded up or discarded */
+          NS_LOG_DEBUG ("Do not buffer old MPDU with sequence number " << seq);
+        }
+      else
         {
+          if (window.GetOffset (seq) >= size)
+            {
+              /* Make room in the ring, this only happens when the originator does not respect
+                 the buffer size of the agreement */
+              RxCompleteBufferedPacketsWithSmallerSequence (((seq - size + 1 + 4096) % 4096) << 4,
+                                                            hdr.GetAddr2 (), hdr.GetQosTid ());
+            }
+          BufferedPackets &slot = window.GetSlot (seq);
+          if (!window.IsPresent (seq))
+            {
+              slot.push_back (BufferedPacket (packet, hdr));
+              window.SetPresent (seq, true);
+            }
+          else
+            {
+              uint8_t fragment = hdr.GetFragmentNumber ();
+              BufferedPackets::iterator i = slot.begin ();
+              while (i != slot.end () && i->second.GetFragmentNumber () < fragment)
+                {
+                  i++;
+                }
+              if (i != slot.end () && i->second.GetFragmentNumber () == fragment)
+                {
+                  NS_LOG_DEBUG ("MPDU with sequence control " << hdr.GetSequenceControl () << " is already buffered");
+                }
+              else
+                {
+                  slot.insert (i, BufferedPacket (packet, hdr));
+                }
+            }
         }
-      (*it).second.second.insert (i, bufferedPacket);
 
       //Update block ack cache
       BlockAckCachesI j = m_bAckCaches.find (std::make_pair (hdr.GetAddr2 (), hdr.GetQosTid ()));
@@ -2593,9 +2692,10 @@ MacLow::CreateBlockAckAgreement (const MgtAddBaResponseHeader *respHdr, Mac48Add
   agreement.SetTimeout (respHdr->GetTimeout ());
   agreement.SetStartingSequence (startingSeq);
 
-  std::list<BufferedPacket> buffer (0);
+  RxWindow window;
+  window.Init (startingSeq, agreement.GetBufferSize ());
   AgreementKey key (originator, respHdr->GetTid ());
-  AgreementValue value (agreement, buffer);
+  AgreementValue value (agreement, window);
   m_bAckAgreements.insert (std::make_pair (key, value));
 
   BlockAckCache cache;
@@ -2631,66 +2731,108 @@ MacLow::DestroyBlockAckAgreement (Mac48Address originator, uint8_t tid)
     }
 }
 
+void
+MacLow::TransferBlockAckAgreements (Mac48Address originator, Ptr<MacLow> target)
+{
+  NS_LOG_FUNCTION (this << originator << target);
+  AgreementsI it = m_bAckAgreements.begin ();
+  while (it != m_bAckAgreements.end ())
+    {
+      AgreementsI current = it++;
+      if (current->first.first != originator)
+        {
+          continue;
+        }
+      AgreementKey key = current->first;
+      current->second.first.m_inactivityEvent.Cancel ();
+      AgreementsI stale = target->m_bAckAgreements.find (key);
+      if (stale != target->m_bAckAgreements.end ())
+        {
+          stale->second.first.m_inactivityEvent.Cancel ();
+          target->DestroyBlockAckAgreement (originator, key.second);
+        }
+      AgreementsI moved = target->m_bAckAgreements.insert (std::make_pair (key, current->second)).first;
+      BlockAckCachesI cache = m_bAckCaches.find (key);
+      NS_ASSERT (cache != m_bAckCaches.end ());
+      target->m_bAckCaches.insert (std::make_pair (key, cache->second));
+      if (moved->second.first.GetTimeout () != 0)
+        {
+          Time timeout = MicroSeconds (1024 * moved->second.first.GetTimeout ());
+          AcIndex ac = QosUtilsMapTidToAc (key.second);
+          moved->second.first.m_inactivityEvent = Simulator::Schedule (timeout,
+                                                                       &EdcaTxopN::SendDelbaFrame,
+                                                                       target->m_edca[ac], originator,
+                                                                       key.second, false);
+        }
+      m_bAckCaches.erase (cache);
+      m_bAckAgreements.erase (current);
+    }
+}
+
+uint8_t
+MacLow::GetFirstMissingFragment (const BufferedPackets &slot)
+{
+  uint8_t fragment = 0;
+  for (BufferedPackets::const_iterator i = slot.begin (); i != slot.end (); i++, fragment++)
+    {
+      if (i->second.GetFragmentNumber () != fragment)
+        {
+          return fragment;
+        }
+      if (!i->second.IsMoreFragments ())
+        {
+          return 16;
+        }
+    }
+  return fragment;
+}
+
+void
+MacLow::ForwardBufferedPackets (const BufferedPackets &packets)
+{
+  for (BufferedPackets::const_iterator i = packets.begin (); i != packets.end (); i++)
+    {
+      m_rxCallback (i->first, &i->second);
+    }
+}
+
 void
 MacLow::RxCompleteBufferedPacketsWithSmallerSequence (uint16_t seq, Mac48Address originator, uint8_t tid)
 {
   AgreementsI it = m_bAckAgreements.find (std::make_pair (originator, tid));
   if (it != m_bAckAgreements.end ())
     {
-      uint16_t endSequence = ((*it).second.first.GetStartingSequence () + 2047) % 4096;
-      uint16_t mappedStart = QosUtilsMapSeqControlToUniqueInteger (seq, endSequence);
-      BufferedPacketI last = (*it).second.second.begin ();
-      uint16_t guard = 0;
-      if (last != (*it).second.second.end ())
+      RxWindow &window = it->second.second;
+      uint16_t end = seq >> 4;
+      uint16_t offset = window.GetOffset (end);
+      if (offset >= 2048)
         {
-          guard = (*it).second.second.begin ()->second.GetSequenceControl ();
+          /* Nothing older than the start of the ring is buffered */
+          return;
         }
-      BufferedPacketI i = (*it).second.second.begin ();
-      for (; i != (*it).second.second.end ()
-           && QosUtilsMapSeqControlToUniqueInteger ((*i).second.GetSequenceControl (), endSequence) < mappedStart; )
+      /* Release the whole run first, the buffer may be updated again while forwarding */
+      BufferedPackets packets;
+      for (uint16_t i = 0; i < offset && i < window.slots.size () && window.count > 0; i++)
         {
-          if (guard == (*i).second.GetSequenceControl ())
+          uint16_t current = (window.base + i) % 4096;
+          if (!window.IsPresent (current))
             {
-              if (!(*i).second.IsMoreFragments ())
-                {
-                  while (last != i)
-                    {
-                      m_rxCallback ((*last).first, &(*last).second);
-                      last++;
-                    }
-                  m_rxCallback ((*last).first, &(*last).second);
-                  last++;
-                  /* go to next packet */
-                  while (i != (*it).second.second.end () && guard == (*i).second.GetSequenceControl ())
-                    {
-                      i++;
-                    }
-                  if (i != (*it).second.second.end ())
-                    {
-                      guard = (*i).second.GetSequenceControl ();
-                      last = i;
-                    }
-                }
-              else
-                {
-                  guard++;
-                }
+              continue;
+            }
+          BufferedPackets &slot = window.GetSlot (current);
+          if (GetFirstMissingFragment (slot) == 16)
+            {
+              packets.insert (packets.end (), slot.begin (), slot.end ());
             }
           else
             {
-              /* go to next packet */
-              while (i != (*it).second.second.end () && guard == (*i).second.GetSequenceControl ())
-                {
-                  i++;
-                }
-              if (i != (*it).second.second.end ())
-                {
-                  guard = (*i).second.GetSequenceControl ();
-                  last = i;
-                }
+              NS_LOG_DEBUG ("Discard incomplete MSDU with sequence number " << current);
             }
+          slot.clear ();
+          window.SetPresent (current, false);
         }
-      (*it).second.second.erase ((*it).second.second.begin (), i);
+      window.base = end;
+      ForwardBufferedPackets (packets);
     }
 }
 
@@ -2700,27 +2842,28 @@ MacLow::RxCompleteBufferedPacketsUntilFirstLost (Mac48Address originator, uint8_
   AgreementsI it = m_bAckAgreements.find (std::make_pair (originator, tid));
   if (it != m_bAckAgreements.end ())
     {
-      uint16_t guard = (*it).second.first.GetStartingSequenceControl ();
-      BufferedPacketI lastComplete = (*it).second.second.begin ();
-      BufferedPacketI i = (*it).second.second.begin ();
-      for (; i != (*it).second.second.end () && guard == (*i).second.GetSequenceControl (); i++)
+      RxWindow &window = it->second.second;
+      uint16_t guard = it->second.first.GetStartingSequenceControl ();
+      uint16_t current = guard >> 4;
+      BufferedPackets packets;
+      while (window.count > 0 && window.GetOffset (current) < window.slots.size () && window.IsPresent (current))
         {
-          if (!(*i).second.IsMoreFragments ())
+          BufferedPackets &slot = window.GetSlot (current);
+          uint8_t fragment = GetFirstMissingFragment (slot);
+          if (fragment != 16)
             {
-              while (lastComplete != i)
-                {
-                  m_rxCallback ((*lastComplete).first, &(*lastComplete).second);
-                  lastComplete++;
-                }
-              m_rxCallback ((*lastComplete).first, &(*lastComplete).second);
-              lastComplete++;
+              guard = (current << 4) | fragment;
+              break;
             }
-          guard = (*i).second.IsMoreFragments () ? (guard + 1) : ((guard + 16) & 0xfff0);
+          packets.insert (packets.end (), slot.begin (), slot.end ());
+          slot.clear ();
+          window.SetPresent (current, false);
+          current = (current + 1) % 4096;
+          guard = current << 4;
+          window.base = current;
         }
-      (*it).second.first.SetStartingSequenceControl (guard);
-      /* All packets already forwarded to WifiMac must be removed from buffer:
-      [begin (), lastComplete) */
-      (*it).second.second.erase ((*it).second.second.begin (), lastComplete);
+      it->second.first.SetStartingSequenceControl (guard);
+      ForwardBufferedPackets (packets);
     }
 }
 
@@ -3000,11 +3143,33 @@ MacLow::StopMpduAggregation (Ptr<const Packet> peekedPacket, WifiMacHeader peeke
       return true;
     }
 
-  Time aPPDUMaxTime = MicroSeconds (5484);
   uint8_t tid = GetTid (peekedPacket, peekedHdr);
   AcIndex ac = QosUtilsMapTidToAc (tid);
   std::map<AcIndex, Ptr<EdcaTxopN> >::const_iterator edcaIt = m_edca.find (ac);
+  uint32_t mpduSize = peekedPacket->GetSize () + peekedHdr.GetSize () + WIFI_MAC_FCS_LENGTH;
+  uint32_t ampduSize = aggregatedPacket->GetSize ();
+
+  //A STA shall not transmit a PPDU that has a duration that is greater than aPPDUMaxTime
+  if (ampduSize + mpduSize > m_ampduByteBudget)
+    {
+      NS_LOG_DEBUG ("no more packets can be aggregated to satisfy PPDU <= aPPDUMaxTime");
+      return true;
+    }
+
+  if (!edcaIt->second->GetMpduAggregator ()->CanBeAggregated (mpduSize, ampduSize, size))
+    {
+      NS_LOG_DEBUG ("no more packets can be aggregated because the maximum A-MPDU size has been reached");
+      return true;
+    }
+
+  return false;
+}
 
+uint32_t
+MacLow::CalculateAmpduByteBudget (uint32_t maxAmpduSize) const
+{
+  NS_LOG_FUNCTION (this << maxAmpduSize);
+  Time aPPDUMaxTime = MicroSeconds (5484);
   if (m_phy->GetStandard () == WIFI_PHY_STANDARD_80211ad)
     {
       aPPDUMaxTime = MilliSeconds (2);
@@ -3014,20 +3179,28 @@ MacLow::StopMpduAggregation (Ptr<const Packet> peekedPacket, WifiMacHeader peeke
       aPPDUMaxTime = MicroSeconds (10000);
     }
 
-  //A STA shall not transmit a PPDU that has a duration that is greater than aPPDUMaxTime
-  if (m_phy->CalculateTxDuration (aggregatedPacket->GetSize () + peekedPacket->GetSize () + peekedHdr.GetSize () + WIFI_MAC_FCS_LENGTH, m_currentTxVector, m_phy->GetFrequency ()) > aPPDUMaxTime)
+  //The PPDU duration increases with the PSDU size, so look for the largest PSDU that fits in aPPDUMaxTime.
+  //Any larger candidate is rejected by the maximum A-MPDU size anyway, hence the upper bound.
+  if (m_phy->CalculateTxDuration (maxAmpduSize, m_currentTxVector, m_phy->GetFrequency ()) <= aPPDUMaxTime)
     {
-      NS_LOG_DEBUG ("no more packets can be aggregated to satisfy PPDU <= aPPDUMaxTime");
-      return true;
+      return maxAmpduSize;
     }
-
-  if (!edcaIt->second->GetMpduAggregator ()->CanBeAggregated (peekedPacket->GetSize () + peekedHdr.GetSize () + WIFI_MAC_FCS_LENGTH, aggregatedPacket, size))
+  uint32_t low = 0;
+  uint32_t high = maxAmpduSize;
+  while (high - low > 1)
     {
-      NS_LOG_DEBUG ("no more packets can be aggregated because the maximum A-MPDU size has been reached");
-      return true;
+      uint32_t middle = low + (high - low) / 2;
+      if (m_phy->CalculateTxDuration (middle, m_currentTxVector, m_phy->GetFrequency ()) <= aPPDUMaxTime)
+        {
+          low = middle;
+        }
+      else
+        {
+          high = middle;
+        }
     }
-
-  return false;
+  NS_LOG_DEBUG ("A-MPDU byte budget=" << low << " for " << m_currentTxVector.GetMode ());
+  return low;
 }
 
 Ptr<Packet>
@@ -3070,6 +3243,8 @@ MacLow::AggregateToAmpdu (Ptr<const Packet> packet, const WifiMacHeader hdr)
               /* here is performed mpdu aggregation */
               /* MSDU aggregation happened in edca if the user asked for it so m_currentPacket may contains a normal packet or a A-MSDU*/
               currentAggregatedPacket = Create<Packet> ();
+              m_ampduByteBudget = CalculateAmpduByteBudget (edcaIt->second->GetMpduAggregator ()->GetMaxAmpduSize ());
+              uint32_t mpduBytes = 0;
               peekedHdr = hdr;
               uint16_t startingSequenceNumber = 0;
               uint16_t currentSequenceNumber = 0;
@@ -3094,6 +3269,7 @@ MacLow::AggregateToAmpdu (Ptr<const Packet> packet, const WifiMacHeader hdr)
                     {
                       NS_LOG_DEBUG ("Adding packet with sequence number " << currentSequenceNumber << " to A-MPDU, packet size = " << newPacket->GetSize () << ", A-MPDU size = " << currentAggregatedPacket->GetSize ());
                       i++;
+                      mpduBytes += newPacket->GetSize ();
                       m_aggregateQueue[tid]->Enqueue (Create<WifiMacQueueItem> (aggPacket, peekedHdr));
                     }
                 }
@@ -3178,6 +3354,7 @@ MacLow::AggregateToAmpdu (Ptr<const Packet> packet, const WifiMacHeader hdr)
                         }
                       NS_LOG_DEBUG ("Adding packet with sequence number " << peekedHdr.GetSequenceNumber () << " to A-MPDU, packet size = " << newPacket->GetSize () << ", A-MPDU size = " << currentAggregatedPacket->GetSize ());
                       i++;
+                      mpduBytes += newPacket->GetSize ();
                       isAmpdu = true;
                       if (!m_txParams.MustSendRts ())
                         {
@@ -3273,6 +3450,7 @@ MacLow::AggregateToAmpdu (Ptr<const Packet> packet, const WifiMacHeader hdr)
                       newPacket->AddHeader (peekedHdr);
                       AddWifiMacTrailer (newPacket);
                       edcaIt->second->GetMpduAggregator ()->Aggregate (newPacket, currentAggregatedPacket);
+                      mpduBytes += newPacket->GetSize ();
                       currentAggregatedPacket->AddHeader (blockAckReq);
                     }
 
@@ -3281,6 +3459,8 @@ MacLow::AggregateToAmpdu (Ptr<const Packet> packet, const WifiMacHeader hdr)
                       edcaIt->second->CompleteAmpduTransfer (hdr.GetAddr1 (), tid);
                     }
 
+                  edcaIt->second->GetMpduAggregator ()->NotifyAmpduBuilt (i, mpduBytes, currentAggregatedPacket->GetSize (), m_ampduByteBudget);
+
                   //Add packet tag
                   AmpduTag ampdutag;
                   ampdutag.SetRemainingNbOfMpdus (i - 1);
@@ -473,6 +473,15 @@ public:
    * invoked when a DELBA frame is received from <i>originator</i>.
    */
   void DestroyBlockAckAgreement (Mac48Address originator, uint8_t tid);
+  /**
+   * \param originator Address of peer participating in Block Ack mechanism.
+   * \param target The MacLow of the technology taking over the session.
+   *
+   * Move all the block ack agreements established by <i>originator</i>, including
+   * the reordering buffer and the scoreboard, to <i>target</i>. This is used by Fast
+   * Session Transfer so the recipient window continues in the new band.
+   */
+  void TransferBlockAckAgreements (Mac48Address originator, Ptr<MacLow> target);
   /**
    * \param ac Access class managed by the queue.
    * \param edca the EdcaTxopN for the queue.
@@ -510,6 +519,15 @@ public:
    *
    */
   bool StopMpduAggregation (Ptr<const Packet> peekedPacket, WifiMacHeader peekedHdr, Ptr<Packet> aggregatedPacket, uint16_t size) const;
+  /**
+   * \param maxAmpduSize the maximum A-MPDU size in bytes.
+   * \return the maximum size of the PSDU that can be sent with the current TXVECTOR
+   *         without exceeding aPPDUMaxTime, bounded by <i>maxAmpduSize</i>.
+   *
+   * The byte budget is computed once per A-MPDU so that the candidate MPDUs
+   * are checked against it without further duration calculations.
+   */
+  uint32_t CalculateAmpduByteBudget (uint32_t maxAmpduSize) const;
   /**
    *
    * This function is called to flush the aggregate queue, which is used for A-MPDU
@@ -926,8 +944,8 @@ private:
    *
    * This method checks if exists a valid established block ack agreement.
    * If there is, store the packet without pass it up to WifiMac. The packet is buffered
-   * in order of increasing sequence control field. All comparison are performed
-   * circularly modulo 2^12.
+   * in the slot of its sequence number in the reorder buffer of the agreement. All
+   * comparison are performed circularly modulo 2^12.
    */
   bool StoreMpduIfNeeded (Ptr<Packet> packet, WifiMacHeader hdr);
   /**
@@ -1082,6 +1100,7 @@ private:
 
   bool m_promisc;  //!< Flag if the device is operating in promiscuous mode
   bool m_ampdu;    //!< Flag if the current transmission involves an A-MPDU
+  uint32_t m_ampduByteBudget; //!< The maximum PSDU size of the A-MPDU being built
 
   class PhyMacLowListener * m_phyMacLowListener; //!< Listener needed to monitor when a channel switching occurs.
 
@@ -1089,10 +1108,67 @@ private:
    * BlockAck data structures.
    */
   typedef std::pair<Ptr<Packet>, WifiMacHeader> BufferedPacket; //!< buffered packet typedef
-  typedef std::list<BufferedPacket>::iterator BufferedPacketI; //!< buffered packet iterator typedef
+  typedef std::vector<BufferedPacket> BufferedPackets; //!< buffered packets typedef
+
+  /**
+   * The reorder buffer of a block ack agreement on the recipient side. The MPDUs are
+   * stored in a ring of slots indexed by their sequence number, each slot holding the
+   * fragments of one MSDU in fragment number order, and a bitmap flags the slots in use.
+   * All the buffered MPDUs have a sequence number in [base, base + ring size), so
+   * storing an MPDU and finding the next one to forward are constant time.
+   */
+  struct RxWindow
+  {
+    RxWindow ();
+    /**
+     * \param startingSeq the starting sequence number of the agreement
+     * \param bufferSize the buffer size of the agreement
+     */
+    void Init (uint16_t startingSeq, uint16_t bufferSize);
+    /**
+     * \param seq the sequence number
+     * 
+eturn the distance from the start of the ring to the sequence number, modulo 4096
+     */
+    uint16_t GetOffset (uint16_t seq) const;
+    /**
+     * \param seq the sequence number, which must be inside the ring
+     * 
+eturn true if MPDUs with the given sequence number are buffered
+     */
+    bool IsPresent (uint16_t seq) const;
+    /**
+     * \param seq the sequence number, which must be inside the ring
+     * \param present true if MPDUs with the given sequence number are buffered
+     */
+    void SetPresent (uint16_t seq, bool present);
+    /**
+     * \param seq the sequence number, which must be inside the ring
+     * 
+eturn the slot holding the MPDUs with the given sequence number
+     */
+    BufferedPackets & GetSlot (uint16_t seq);
+
+    std::vector<BufferedPackets> slots; ///< the buffered MPDUs, indexed by sequence number modulo the ring size
+    std::vector<uint64_t> presentBitmap; ///< one bit per slot holding buffered MPDUs
+    uint16_t base; ///< the sequence number of the start of the ring
+    uint16_t count; ///< the number of slots holding buffered MPDUs
+  };
 
   typedef std::pair<Mac48Address, uint8_t> AgreementKey; //!< agreement key typedef
-  typedef std::pair<BlockAckAgreement, std::list<BufferedPacket> > AgreementValue; //!< agreement value typedef
+  typedef std::pair<BlockAckAgreement, RxWindow> AgreementValue; //!< agreement value typedef
+
+  /**
+   * \param slot the fragments of a buffered MSDU, in fragment number order
+   * \return the fragment number of the first missing fragment, or 16 if the MSDU is complete
+   */
+  static uint8_t GetFirstMissingFragment (const BufferedPackets &slot);
+  /**
+   * \param packets the MPDUs released from a reorder buffer, in sequence control order
+   *
+   * Forward up to WifiMac a run of MPDUs released from a reorder buffer.
+   */
+  void ForwardBufferedPackets (const BufferedPackets &packets);
 
   typedef std::map<AgreementKey, AgreementValue> Agreements; //!< agreements
   typedef std::map<AgreementKey, AgreementValue>::iterator AgreementsI; //!< agreements iterator
@@ -124,4 +124,24 @@ MacTxMiddle::GetNextSeqNumberByTidAndAddress (uint8_t tid, Mac48Address addr) co
   return seq;
 }
 
+void
+MacTxMiddle::CopySequenceNumbers (Mac48Address addr, Ptr<MacTxMiddle> target) const
+{
+  NS_LOG_FUNCTION (this << addr << target);
+  std::map <Mac48Address,uint16_t*>::const_iterator it = m_qosSequences.find (addr);
+  if (it == m_qosSequences.end ())
+    {
+      return;
+    }
+  std::map <Mac48Address,uint16_t*>::iterator targetIt = target->m_qosSequences.find (addr);
+  if (targetIt == target->m_qosSequences.end ())
+    {
+      targetIt = target->m_qosSequences.insert (std::make_pair (addr, new uint16_t[16])).first;
+    }
+  for (uint8_t i = 0; i < 16; i++)
+    {
+      targetIt->second[i] = it->second[i];
+    }
+}
+
 } //namespace ns3
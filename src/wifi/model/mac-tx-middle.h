@@ -26,6 +26,7 @@
 #include <map>
 #include "ns3/mac48-address.h"
 #include "ns3/simple-ref-count.h"
+#include "ns3/ptr.h"
 
 namespace ns3 {
 
@@ -65,6 +66,14 @@ public:
    * \return the next sequence number
    */
   uint16_t GetNextSeqNumberByTidAndAddress (uint8_t tid, Mac48Address addr) const;
+  /**
+   * Copy the QoS sequence numbers of a destination to another MacTxMiddle so a session
+   * moved to another technology continues the same sequence number space.
+   *
+   * \param addr destination address
+   * \param target the MacTxMiddle to copy the sequence numbers to
+   */
+  void CopySequenceNumbers (Mac48Address addr, Ptr<MacTxMiddle> target) const;
 
 
 private:
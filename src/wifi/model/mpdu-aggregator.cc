@@ -35,6 +35,11 @@ MpduAggregator::GetTypeId (void)
     .SetParent<Object> ()
     .SetGroupName ("Wifi")
     .AddConstructor<MpduAggregator> ()
+    .AddTraceSource ("AmpduBuilt",
+                     "An A-MPDU has been built with the given number of MPDUs, MPDU bytes, "
+                     "A-MPDU size and byte budget",
+                     MakeTraceSourceAccessor (&MpduAggregator::m_ampduBuiltTrace),
+                     "ns3::MpduAggregator::AmpduBuiltCallback")
   ;
   return tid;
 }
@@ -63,26 +68,12 @@ bool
 MpduAggregator::Aggregate (Ptr<const Packet> packet, Ptr<Packet> aggregatedPacket) const
 {
   NS_LOG_FUNCTION (this);
-  Ptr<Packet> currentPacket;
-  AmpduSubframeHeader currentHdr;
-
   uint8_t padding = CalculatePadding (aggregatedPacket);
   uint32_t actualSize = aggregatedPacket->GetSize ();
 
   if ((4 + packet->GetSize () + actualSize + padding) <= m_maxAmpduLength)
     {
-      if (padding)
-        {
-          Ptr<Packet> pad = Create<Packet> (padding);
-          aggregatedPacket->AddAtEnd (pad);
-        }
-      currentHdr.SetCrc (1);
-      currentHdr.SetSig ();
-      currentHdr.SetLength (packet->GetSize ());
-      currentPacket = packet->Copy ();
-
-      currentPacket->AddHeader (currentHdr);
-      aggregatedPacket->AddAtEnd (currentPacket);
+      AddSubframe (packet->GetSize (), padding, aggregatedPacket);
       return true;
     }
   return false;
@@ -92,24 +83,19 @@ void
 MpduAggregator::AggregateSingleMpdu (Ptr<const Packet> packet, Ptr<Packet> aggregatedPacket) const
 {
   NS_LOG_FUNCTION (this);
-  Ptr<Packet> currentPacket;
-  AmpduSubframeHeader currentHdr;
-
-  uint8_t padding = CalculatePadding (aggregatedPacket);
-  if (padding)
-    {
-      Ptr<Packet> pad = Create<Packet> (padding);
-      aggregatedPacket->AddAtEnd (pad);
-    }
-
-  currentHdr.SetEof (1);
-  currentHdr.SetCrc (1);
-  currentHdr.SetSig ();
-  currentHdr.SetLength (packet->GetSize ());
-  currentPacket = packet->Copy ();
+  AddSubframe (packet->GetSize (), CalculatePadding (aggregatedPacket), aggregatedPacket);
+}
 
-  currentPacket->AddHeader (currentHdr);
-  aggregatedPacket->AddAtEnd (currentPacket);
+void
+MpduAggregator::AddSubframe (uint32_t mpduSize, uint8_t padding, Ptr<Packet> aggregatedPacket) const
+{
+  AmpduSubframeHeader currentHdr;
+  //The A-MPDU built by MacLow only tells its length and the number of subframes (AmpduTag), the actual
+  //subframes are created from the aggregate queue by AddHeaderAndPad when they are forwarded to the PHY.
+  //Hence the padding, the subframe header and the MPDU are appended as a zero-filled area, which does not
+  //copy any byte since the zero area of the aggregate is simply extended.
+  Ptr<Packet> subframe = Create<Packet> (padding + currentHdr.GetSerializedSize () + mpduSize);
+  aggregatedPacket->AddAtEnd (subframe);
 }
 
 void
@@ -141,26 +127,38 @@ MpduAggregator::AddHeaderAndPad (Ptr<Packet> packet, bool last, bool isSingleMpd
 bool
 MpduAggregator::CanBeAggregated (uint32_t packetSize, Ptr<Packet> aggregatedPacket, uint8_t blockAckSize) const
 {
-  uint8_t padding = CalculatePadding (aggregatedPacket);
-  uint32_t actualSize = aggregatedPacket->GetSize ();
+  return CanBeAggregated (packetSize, aggregatedPacket->GetSize (), blockAckSize);
+}
+
+bool
+MpduAggregator::CanBeAggregated (uint32_t packetSize, uint32_t ampduSize, uint16_t blockAckSize) const
+{
+  uint8_t padding = CalculatePadding (ampduSize);
+  uint32_t blockAckReqSize = 0;
   if (blockAckSize > 0)
     {
-      blockAckSize = blockAckSize + 4 + padding;
-    }
-  if ((4 + packetSize + actualSize + padding + blockAckSize) <= m_maxAmpduLength)
-    {
-      return true;
-    }
-  else
-    {
-      return false;
+      blockAckReqSize = blockAckSize + 4 + padding;
     }
+  return ((4 + packetSize + ampduSize + padding + blockAckReqSize) <= m_maxAmpduLength);
+}
+
+void
+MpduAggregator::NotifyAmpduBuilt (uint8_t nMpdus, uint32_t mpduBytes, uint32_t ampduSize, uint32_t byteBudget) const
+{
+  NS_LOG_FUNCTION (this << uint16_t (nMpdus) << mpduBytes << ampduSize << byteBudget);
+  m_ampduBuiltTrace (nMpdus, mpduBytes, ampduSize, byteBudget);
 }
 
 uint8_t
 MpduAggregator::CalculatePadding (Ptr<const Packet> packet) const
 {
-  return (4 - (packet->GetSize () % 4 )) % 4;
+  return CalculatePadding (packet->GetSize ());
+}
+
+uint8_t
+MpduAggregator::CalculatePadding (uint32_t size)
+{
+  return (4 - (size % 4 )) % 4;
 }
 
 MpduAggregator::DeaggregatedMpdus
@@ -180,16 +178,26 @@ MpduAggregator::Deaggregate (Ptr<Packet> aggregatedPacket)
     {
       deserialized += aggregatedPacket->RemoveHeader (hdr);
       extractedLength = hdr.GetLength ();
-      extractedMpdu = aggregatedPacket->CreateFragment (0, static_cast<uint32_t> (extractedLength));
-      aggregatedPacket->RemoveAtStart (extractedLength);
       deserialized += extractedLength;
-
       padding = (4 - (extractedLength % 4 )) % 4;
 
-      if (padding > 0 && deserialized < maxSize)
+      if (deserialized + padding >= maxSize)
+        {
+          //MacLow forwards every subframe in its own PHY packet, so the last (and usually the only)
+          //subframe is handed over as is rather than as a new fragment
+          aggregatedPacket->RemoveAtEnd (aggregatedPacket->GetSize () - extractedLength);
+          extractedMpdu = aggregatedPacket;
+          deserialized = maxSize;
+        }
+      else
         {
-          aggregatedPacket->RemoveAtStart (padding);
-          deserialized += padding;
+          extractedMpdu = aggregatedPacket->CreateFragment (0, static_cast<uint32_t> (extractedLength));
+          aggregatedPacket->RemoveAtStart (extractedLength);
+          if (padding > 0)
+            {
+              aggregatedPacket->RemoveAtStart (padding);
+              deserialized += padding;
+            }
         }
 
       std::pair<Ptr<Packet>, AmpduSubframeHeader> packetHdr (extractedMpdu, hdr);
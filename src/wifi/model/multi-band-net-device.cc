@@ -13,6 +13,8 @@
 #include "ns3/llc-snap-header.h"
 #include "ns3/socket.h"
 #include "ns3/pointer.h"
+#include "ns3/boolean.h"
+#include "ns3/trace-source-accessor.h"
 #include "ns3/log.h"
 #include "ns3/net-device-queue-interface.h"
 
@@ -34,12 +36,24 @@ MultiBandNetDevice::GetTypeId (void)
                    MakeUintegerAccessor (&MultiBandNetDevice::SetMtu,
                                          &MultiBandNetDevice::GetMtu),
                    MakeUintegerChecker<uint16_t> (1, MAX_MSDU_SIZE - LLC_SNAP_HEADER_LENGTH))
+    .AddAttribute ("FastSwitch",
+                   "Whether to hand over the queued MSDUs, the BlockAck agreements and the sequence numbers "
+                   "of the peer station to the new band when the band changes. If disabled, only the queued "
+                   "MSDUs are moved and the BlockAck agreements are copied.",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&MultiBandNetDevice::m_fastSwitch),
+                   MakeBooleanChecker ())
+    .AddTraceSource ("BandChanged",
+                     "The active band has changed for a peer station.",
+                     MakeTraceSourceAccessor (&MultiBandNetDevice::m_bandChanged),
+                     "ns3::MultiBandNetDevice::BandChangedTracedCallback")
   ;
   return tid;
 }
 
 MultiBandNetDevice::MultiBandNetDevice ()
-  : m_configComplete (false)
+  : m_configComplete (false),
+    m_fastSwitch (true)
 {
   NS_LOG_FUNCTION_NOARGS ();
 }
@@ -224,6 +238,7 @@ MultiBandNetDevice::BandChanged (enum WifiPhyStandard standard, Mac48Address add
   /* Before switching the current technology, we keep a pointer to the current technology */
   Ptr<RegularWifiMac> oldMac, newMac;
   oldMac = StaticCast<RegularWifiMac> (m_mac);
+  WifiPhyStandard oldStandard = m_standard;
 
   /* Switch current active technology for 802.11 */
   SwitchTechnology (standard);
@@ -231,20 +246,30 @@ MultiBandNetDevice::BandChanged (enum WifiPhyStandard standard, Mac48Address add
   /* In all cases, we copy the content of all the queues (DCA + EDCA) */
   newMac = StaticCast<RegularWifiMac> (m_mac);
 //  m_technologyMap[address] = newMac;
+  uint32_t queuedPackets = GetQueuedPackets (newMac);
 
-  /* Copy DCA Packets */
-  oldMac->GetDcaTxop ()->GetQueue ()->TransferPacketsByAddress (address, newMac->GetDcaTxop ()->GetQueue ());
-  /* Copy EDCA Packets */
-  oldMac->GetVOQueue ()->GetQueue ()->TransferPacketsByAddress (address, newMac->GetVOQueue ()->GetQueue ());
-  oldMac->GetVIQueue ()->GetQueue ()->TransferPacketsByAddress (address, newMac->GetVIQueue ()->GetQueue ());
-  oldMac->GetBEQueue ()->GetQueue ()->TransferPacketsByAddress (address, newMac->GetBEQueue ()->GetQueue ());
-  oldMac->GetBKQueue ()->GetQueue ()->TransferPacketsByAddress (address, newMac->GetBKQueue ()->GetQueue ());
-
-  /* Copy Block ACK aggreements */
-  oldMac->GetVOQueue ()->CopyBlockAckAgreements (address, newMac->GetVOQueue ());
-  oldMac->GetVIQueue ()->CopyBlockAckAgreements (address, newMac->GetVIQueue ());
-  oldMac->GetBEQueue ()->CopyBlockAckAgreements (address, newMac->GetBEQueue ());
-  oldMac->GetBKQueue ()->CopyBlockAckAgreements (address, newMac->GetBKQueue ());
+  if (m_fastSwitch)
+    {
+      /* Hand over the whole session so the transmission resumes without a new BlockAck setup */
+      oldMac->TransferSession (address, newMac);
+    }
+  else
+    {
+      /* Copy DCA Packets */
+      oldMac->GetDcaTxop ()->GetQueue ()->TransferPacketsByAddress (address, newMac->GetDcaTxop ()->GetQueue ());
+      /* Copy EDCA Packets */
+      oldMac->GetVOQueue ()->GetQueue ()->TransferPacketsByAddress (address, newMac->GetVOQueue ()->GetQueue ());
+      oldMac->GetVIQueue ()->GetQueue ()->TransferPacketsByAddress (address, newMac->GetVIQueue ()->GetQueue ());
+      oldMac->GetBEQueue ()->GetQueue ()->TransferPacketsByAddress (address, newMac->GetBEQueue ()->GetQueue ());
+      oldMac->GetBKQueue ()->GetQueue ()->TransferPacketsByAddress (address, newMac->GetBKQueue ()->GetQueue ());
+
+      /* Copy Block ACK aggreements */
+      oldMac->GetVOQueue ()->CopyBlockAckAgreements (address, newMac->GetVOQueue ());
+      oldMac->GetVIQueue ()->CopyBlockAckAgreements (address, newMac->GetVIQueue ());
+      oldMac->GetBEQueue ()->CopyBlockAckAgreements (address, newMac->GetBEQueue ());
+      oldMac->GetBKQueue ()->CopyBlockAckAgreements (address, newMac->GetBKQueue ());
+    }
+  m_bandChanged (oldStandard, standard, address, GetQueuedPackets (newMac) - queuedPackets);
 
   /* Check the type of the BSS */
   if (newMac->GetTypeOfStation () == DMG_STA)
@@ -270,6 +295,18 @@ MultiBandNetDevice::BandChanged (enum WifiPhyStandard standard, Mac48Address add
   m_mac->NotifyBandChanged (standard, address, isInitiator);
 }
 
+uint32_t
+MultiBandNetDevice::GetQueuedPackets (Ptr<RegularWifiMac> mac) const
+{
+  uint32_t packets = mac->GetDcaTxop ()->GetQueue ()->GetNPackets ();
+  EdcaQueues queues = mac->GetEdcaQueues ();
+  for (EdcaQueues::const_iterator i = queues.begin (); i != queues.end (); i++)
+    {
+      packets += i->second->GetQueue ()->GetNPackets ();
+    }
+  return packets;
+}
+
 void
 MultiBandNetDevice::EstablishFastSessionTransferSession (Mac48Address address)
 {
@@ -20,6 +20,7 @@ namespace ns3 {
 class WifiRemoteStationManager;
 class WifiPhy;
 class WifiMac;
+class RegularWifiMac;
 class NetDeviceQueueInterface;
 
 /* Note only one technology should be operational (Tx/Rx Data) at anytime */
@@ -110,6 +111,17 @@ public:
    */
   Ptr<WifiRemoteStationManager> GetRemoteStationManager (void) const;
 
+  /**
+   * TracedCallback signature for band change events.
+   *
+   * \param oldStandard The standard used before the band change.
+   * \param newStandard The standard used after the band change.
+   * \param address The address of the peer station.
+   * \param packets The number of queued packets moved to the new band.
+   */
+  typedef void (* BandChangedTracedCallback)(WifiPhyStandard oldStandard, WifiPhyStandard newStandard,
+                                             Mac48Address address, uint32_t packets);
+
 
   //inherited from NetDevice base class.
   void SetIfIndex (const uint32_t index);
@@ -242,6 +254,11 @@ private:
    * device, or passing a packet to the device, otherwise.
    */
   uint8_t SelectQueue (Ptr<QueueItem> item) const;
+  /**
+   * \param mac The MAC of one of the technologies.
+   * \return The number of packets waiting in the DCA and EDCA queues of the MAC.
+   */
+  uint32_t GetQueuedPackets (Ptr<RegularWifiMac> mac) const;
 
   Ptr<Node> m_node;                           		//!< Node to which this device is attached to.
   Ptr<WifiPhy> m_phy;                               //!< Current Active PHY layer.
@@ -265,6 +282,8 @@ private:
   TracedCallback<> m_linkChanges; //!< link change callback
   mutable uint16_t m_mtu; //!< MTU
   bool m_configComplete; //!< configuration complete
+  bool m_fastSwitch; //!< Flag to indicate whether the whole session is handed over on band change.
+  TracedCallback<WifiPhyStandard, WifiPhyStandard, Mac48Address, uint32_t> m_bandChanged; //!< band changed trace callback
 };
 
 } //namespace ns3
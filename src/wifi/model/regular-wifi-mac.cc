@@ -30,6 +30,7 @@
 #include "msdu-aggregator.h"
 #include "mpdu-aggregator.h"
 #include "wifi-utils.h"
+#include "wifi-mac-queue.h"
 #include "ns3/simulator.h"
 
 namespace ns3 {
@@ -381,6 +382,12 @@ RegularWifiMac::GetBKQueue () const
   return m_edca.find (AC_BK)->second;
 }
 
+EdcaQueues
+RegularWifiMac::GetEdcaQueues () const
+{
+  return m_edca;
+}
+
 void
 RegularWifiMac::SetWifiPhy (const Ptr<WifiPhy> phy)
 {
@@ -413,6 +420,13 @@ RegularWifiMac::SetForwardUpCallback (ForwardUpCallback upCallback)
   m_forwardUp = upCallback;
 }
 
+void
+RegularWifiMac::SetForwardUpBurstCallback (ForwardUpBurstCallback upCallback)
+{
+  NS_LOG_FUNCTION (this);
+  m_forwardUpBurst = upCallback;
+}
+
 void
 RegularWifiMac::SetLinkUpCallback (Callback<void> linkUp)
 {
@@ -801,6 +815,25 @@ RegularWifiMac::ForwardUp (Ptr<Packet> packet, Mac48Address from, Mac48Address t
   m_forwardUp (packet, from, to);
 }
 
+void
+RegularWifiMac::ForwardUpBurst (const MsduAggregator::DeaggregatedMsdus &msdus)
+{
+  NS_LOG_FUNCTION (this << msdus.size ());
+  if (msdus.empty ())
+    {
+      return;
+    }
+  if (m_forwardUpBurst.IsNull ())
+    {
+      for (MsduAggregator::DeaggregatedMsdusCI i = msdus.begin (); i != msdus.end (); ++i)
+        {
+          ForwardUp ((*i).first, (*i).second.GetSourceAddr (), (*i).second.GetDestinationAddr ());
+        }
+      return;
+    }
+  m_forwardUpBurst (msdus);
+}
+
 /**
  * Functions for Fast Session Transfer.
  */
@@ -977,6 +1010,23 @@ RegularWifiMac::SendFstTearDownFrame (Mac48Address to)
   m_dca->Queue (packet, hdr);
 }
 
+void
+RegularWifiMac::TransferSession (Mac48Address address, Ptr<RegularWifiMac> target)
+{
+  NS_LOG_FUNCTION (this << address << target);
+  m_dca->GetQueue ()->TransferPacketsByAddress (address, target->m_dca->GetQueue ());
+  /* The new MAC continues the sequence number space of the transferred agreements */
+  m_txMiddle->CopySequenceNumbers (address, target->m_txMiddle);
+  m_low->TransferBlockAckAgreements (address, target->m_low);
+  for (EdcaQueues::const_iterator i = m_edca.begin (); i != m_edca.end (); i++)
+    {
+      Ptr<EdcaTxopN> edca = target->m_edca.find (i->first)->second;
+      i->second->GetQueue ()->TransferPacketsByAddress (address, edca->GetQueue ());
+      i->second->TransferBlockAckAgreements (address, edca);
+      edca->StartAccessIfNeeded ();
+    }
+}
+
 void
 RegularWifiMac::NotifyBandChanged (enum WifiPhyStandard, Mac48Address address, bool isInitiator)
 {
@@ -1252,12 +1302,7 @@ RegularWifiMac::DeaggregateAmsduAndForward (Ptr<Packet> aggregatedPacket, const
 {
   NS_LOG_FUNCTION (this << aggregatedPacket << hdr);
   MsduAggregator::DeaggregatedMsdus packets = MsduAggregator::Deaggregate (aggregatedPacket);
-  for (MsduAggregator::DeaggregatedMsdusCI i = packets.begin ();
-       i != packets.end (); ++i)
-    {
-      ForwardUp ((*i).first, (*i).second.GetSourceAddr (),
-                 (*i).second.GetDestinationAddr ());
-    }
+  ForwardUpBurst (packets);
 }
 
 void
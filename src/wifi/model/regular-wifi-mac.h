@@ -293,6 +293,19 @@ public:
    * forwarded up the stack.
    */
   void SetForwardUpCallback (ForwardUpCallback upCallback);
+  /**
+   * This type defines the callback of a higher layer that a
+   * WifiMac(-derived) object invokes to pass the MSDUs of an A-MSDU
+   * up the stack at once.
+   *
+   * \param msdus the MSDUs and their subframe headers, in order of reception.
+   */
+  typedef Callback<void, const MsduAggregator::DeaggregatedMsdus &> ForwardUpBurstCallback;
+  /**
+   * \param upCallback the callback to invoke when the MSDUs of an A-MSDU
+   * must be forwarded up the stack at once.
+   */
+  void SetForwardUpBurstCallback (ForwardUpBurstCallback upCallback);
   /**
    * \param linkUp the callback to invoke when the link becomes up.
    */
@@ -350,6 +363,14 @@ public:
    * \param staAddress The address of the sta to establish FST session with it.
    */
   void SetupFSTSession (Mac48Address staAddress);
+  /**
+   * Move the session with a peer station to the MAC of another band. The queued MSDUs,
+   * the BlockAck agreements in both directions, the unacknowledged MPDUs and the QoS
+   * sequence numbers are handed over, so the session resumes without a new BlockAck setup.
+   * \param address The address of the peer station.
+   * \param target The MAC of the technology taking over the session.
+   */
+  void TransferSession (Mac48Address address, Ptr<RegularWifiMac> target);
   /**
    * Get Type Of Station.
    * \return station type
@@ -369,6 +390,7 @@ protected:
   Ptr<WifiRemoteStationManager> m_stationManager; //!< Remote station manager (rate control, RTS/CTS/fragmentation thresholds etc.)
 
   ForwardUpCallback m_forwardUp; //!< Callback to forward packet up the stack
+  ForwardUpBurstCallback m_forwardUpBurst; //!< Callback to forward the MSDUs of an A-MSDU up the stack
   Callback<void> m_linkUp;       //!< Callback when a link is up
   Callback<void> m_linkDown;     //!< Callback when a link is down
   Callback<void> m_sessionTransfer; //!< Callback when a session transfer takes place
@@ -499,6 +521,13 @@ protected:
    * \param to the address of the destination
    */
   void ForwardUp (Ptr<Packet> packet, Mac48Address from, Mac48Address to);
+  /**
+   * Forward the MSDUs of an A-MSDU up to the device at once, or one by one
+   * if the device does not support it.
+   *
+   * \param msdus the MSDUs and their subframe headers
+   */
+  void ForwardUpBurst (const MsduAggregator::DeaggregatedMsdus &msdus);
 
   /**
    * This method can be called to de-aggregate an A-MSDU and forward
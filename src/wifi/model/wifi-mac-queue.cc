@@ -53,6 +53,9 @@ WifiMacQueue::GetTypeId (void)
     .AddTraceSource ("OccupancyChanged", "The number of the packets in the queue has changed.",
                      MakeTraceSourceAccessor (&WifiMacQueue::m_nPackets),
                      "ns3::TracedValueCallback::Uint32")
+    .AddTraceSource ("Backlog", "The number of the packets in the queue for a receiver has changed.",
+                     MakeTraceSourceAccessor (&WifiMacQueue::m_backlogTrace),
+                     "ns3::WifiMacQueue::BacklogTracedCallback")
   ;
   return tid;
 }
@@ -99,6 +102,178 @@ WifiMacQueue::TtlExceeded (ConstIterator &it)
   return false;
 }
 
+bool
+WifiMacQueue::GetFlowId (Ptr<const WifiMacQueueItem> item, FlowId &flow)
+{
+  if (!item->GetHeader ().IsQosData ())
+    {
+      return false;
+    }
+  flow = FlowId (item->GetHeader ().GetAddr1 (), item->GetHeader ().GetQosTid ());
+  return true;
+}
+
+bool
+WifiMacQueue::IsIndexed (WifiMacHeader::AddressType type)
+{
+  return (type == WifiMacHeader::ADDR1);
+}
+
+bool
+WifiMacQueue::GetFlowHead (uint8_t tid, Mac48Address addr, ConstIterator &it)
+{
+  NS_LOG_FUNCTION (this << +tid << addr);
+
+  // the flow is erased from the index once its last item is removed, hence
+  // we look it up again after every expired item
+  for (Flows::iterator flow = m_flows.find (FlowId (addr, tid)); flow != m_flows.end ();
+       flow = m_flows.find (FlowId (addr, tid)))
+    {
+      it = flow->second.front ();
+      ConstIterator head = it;
+      if (!TtlExceeded (head))
+        {
+          return true;
+        }
+    }
+  return false;
+}
+
+bool
+WifiMacQueue::GetFirstAvailableForReceiver (Mac48Address addr, const Ptr<QosBlockedDestinations> blockedPackets,
+                                            ConstIterator &it)
+{
+  NS_LOG_FUNCTION (this << addr);
+
+  Receivers::iterator receiver = m_receivers.find (addr);
+  if (receiver == m_receivers.end ())
+    {
+      return false;
+    }
+  // the index of a receiver is kept when its last item is removed, so we can
+  // move to the next item before removing an expired one
+  for (FlowQueue::iterator i = receiver->second.begin (); i != receiver->second.end (); )
+    {
+      ConstIterator pos = *i++;
+      ConstIterator next = pos;
+      if (!TtlExceeded (next) && (*pos)->GetHeader ().IsQosData ()
+          && !blockedPackets->IsBlocked (addr, (*pos)->GetHeader ().GetQosTid ()))
+        {
+          it = pos;
+          return true;
+        }
+    }
+  return false;
+}
+
+void
+WifiMacQueue::RemoveFromIndex (ConstIterator pos)
+{
+  FlowId id;
+  if (GetFlowId (*pos, id))
+    {
+      Flows::iterator flow = m_flows.find (id);
+      NS_ASSERT (flow != m_flows.end ());
+      // items almost always leave their flow from the head
+      if (flow->second.front () == pos)
+        {
+          flow->second.pop_front ();
+        }
+      else
+        {
+          flow->second.remove (pos);
+        }
+      if (flow->second.empty ())
+        {
+          m_flows.erase (flow);
+        }
+    }
+  Mac48Address addr = (*pos)->GetHeader ().GetAddr1 ();
+  Receivers::iterator receiver = m_receivers.find (addr);
+  NS_ASSERT (receiver != m_receivers.end ());
+  if (receiver->second.front () == pos)
+    {
+      receiver->second.pop_front ();
+    }
+  else
+    {
+      receiver->second.remove (pos);
+    }
+  m_backlogTrace (addr, receiver->second.size ());
+}
+
+void
+WifiMacQueue::RebuildIndex (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  m_flows.clear ();
+  m_receivers.clear ();
+  FlowId id;
+  for (auto it = Head (); it != Tail (); it++)
+    {
+      if (GetFlowId (*it, id))
+        {
+          m_flows[id].push_back (it);
+        }
+      m_receivers[(*it)->GetHeader ().GetAddr1 ()].push_back (it);
+    }
+}
+
+bool
+WifiMacQueue::DoEnqueue (ConstIterator pos, Ptr<WifiMacQueueItem> item)
+{
+  if (!Queue<WifiMacQueueItem>::DoEnqueue (pos, item))
+    {
+      return false;
+    }
+  ConstIterator it = pos;
+  it--;
+  Mac48Address addr = item->GetHeader ().GetAddr1 ();
+  if (pos != Tail () && it != Head ())
+    {
+      RebuildIndex ();
+    }
+  else
+    {
+      FlowId id;
+      bool hasFlow = GetFlowId (item, id);
+      FlowQueue &receiver = m_receivers[addr];
+      if (pos == Tail ())
+        {
+          if (hasFlow)
+            {
+              m_flows[id].push_back (it);
+            }
+          receiver.push_back (it);
+        }
+      else
+        {
+          if (hasFlow)
+            {
+              m_flows[id].push_front (it);
+            }
+          receiver.push_front (it);
+        }
+    }
+  m_backlogTrace (addr, m_receivers[addr].size ());
+  return true;
+}
+
+Ptr<WifiMacQueueItem>
+WifiMacQueue::DoDequeue (ConstIterator pos)
+{
+  RemoveFromIndex (pos);
+  return Queue<WifiMacQueueItem>::DoDequeue (pos);
+}
+
+Ptr<WifiMacQueueItem>
+WifiMacQueue::DoRemove (ConstIterator pos)
+{
+  RemoveFromIndex (pos);
+  return Queue<WifiMacQueueItem>::DoRemove (pos);
+}
+
 bool
 WifiMacQueue::Enqueue (Ptr<WifiMacQueueItem> item)
 {
@@ -175,6 +350,17 @@ WifiMacQueue::DequeueByTidAndAddress (uint8_t tid,
 {
   NS_LOG_FUNCTION (this << dest);
 
+  if (IsIndexed (type))
+    {
+      ConstIterator it;
+      if (GetFlowHead (tid, dest, it))
+        {
+          return DoDequeue (it);
+        }
+      NS_LOG_DEBUG ("The queue is empty");
+      return 0;
+    }
+
   for (auto it = Head (); it != Tail (); )
     {
       if (!TtlExceeded (it))
@@ -219,6 +405,17 @@ WifiMacQueue::DequeueByAddress (WifiMacHeader::AddressType type, Mac48Address de
 {
   NS_LOG_FUNCTION (this << dest);
 
+  if (IsIndexed (type))
+    {
+      ConstIterator it;
+      if (GetFirstAvailableForReceiver (dest, blockedPackets, it))
+        {
+          return DoDequeue (it);
+        }
+      NS_LOG_DEBUG ("The queue is empty");
+      return 0;
+    }
+
   for (auto it = Head (); it != Tail (); )
     {
       if (!TtlExceeded (it))
@@ -260,6 +457,17 @@ WifiMacQueue::PeekByTidAndAddress (uint8_t tid,
 {
   NS_LOG_FUNCTION (this << dest);
 
+  if (IsIndexed (type))
+    {
+      ConstIterator it;
+      if (GetFlowHead (tid, dest, it))
+        {
+          return DoPeek (it);
+        }
+      NS_LOG_DEBUG ("The queue is empty");
+      return 0;
+    }
+
   for (auto it = Head (); it != Tail (); )
     {
       if (!TtlExceeded (it))
@@ -305,6 +513,17 @@ WifiMacQueue::PeekFirstAvailableByAddress (WifiMacHeader::AddressType type,
 {
   NS_LOG_FUNCTION (this);
 
+  if (IsIndexed (type))
+    {
+      ConstIterator it;
+      if (GetFirstAvailableForReceiver (dest, blockedPackets, it))
+        {
+          return DoPeek (it);
+        }
+      NS_LOG_DEBUG ("The queue is empty");
+      return 0;
+    }
+
   for (auto it = Head (); it != Tail (); )
     {
       if (!TtlExceeded (it))
@@ -368,6 +587,19 @@ WifiMacQueue::GetNPacketsByTidAndAddress (uint8_t tid, WifiMacHeader::AddressTyp
 
   uint32_t nPackets = 0;
 
+  if (IsIndexed (type))
+    {
+      // items of a flow are queued in timestamp order, so none of them is stale
+      // once the head of the flow is not
+      ConstIterator it;
+      if (GetFlowHead (tid, addr, it))
+        {
+          nPackets = m_flows[FlowId (addr, tid)].size ();
+        }
+      NS_LOG_DEBUG ("returns " << nPackets);
+      return nPackets;
+    }
+
   for (auto it = Head (); it != Tail (); )
     {
       if (!TtlExceeded (it))
@@ -414,6 +646,7 @@ WifiMacQueue::TransferPacketsByAddress (Mac48Address addr, Ptr<WifiMacQueue> des
               /* Copy the item to the new Queue */
               Ptr<WifiMacQueueItem> item = Create<WifiMacQueueItem> ((*it)->GetPacket (), (*it)->GetHeader ());
               destQueue->Enqueue (item);
+              RemoveFromIndex (it);
               it = m_packets.erase (it);
               m_nBytes -= item->GetSize ();
               m_nPackets--;
@@ -436,6 +669,7 @@ WifiMacQueue::QuickTransfer (Ptr<WifiMacQueue> destQueue)
           /* Copy the item to the new Queue */
           Ptr<WifiMacQueueItem> item = Create<WifiMacQueueItem> ((*it)->GetPacket (), (*it)->GetHeader ());
           destQueue->Enqueue (item);
+          RemoveFromIndex (it);
           it = m_packets.erase (it);
           m_nBytes -= item->GetSize ();
           m_nPackets--;
@@ -446,20 +680,39 @@ WifiMacQueue::QuickTransfer (Ptr<WifiMacQueue> destQueue)
 bool
 WifiMacQueue::HasPacketsForReceiver (Mac48Address addr)
 {
-  for (auto it = Head (); it != Tail (); )
+  Receivers::iterator receiver = m_receivers.find (addr);
+  if (receiver == m_receivers.end ())
     {
-      if (!TtlExceeded (it))
+      return false;
+    }
+  for (FlowQueue::iterator i = receiver->second.begin (); i != receiver->second.end (); )
+    {
+      ConstIterator pos = *i++;
+      if (!TtlExceeded (pos))
         {
-          if ((*it)->GetHeader ().GetAddr1 () == addr)
-            {
-              return true;
-            }
-          it++;
+          return true;
         }
     }
   return false;
 }
 
+uint32_t
+WifiMacQueue::GetNPacketsForReceiver (Mac48Address addr)
+{
+  Receivers::iterator receiver = m_receivers.find (addr);
+  if (receiver == m_receivers.end ())
+    {
+      return 0;
+    }
+  // remove packets that stayed in the queue for too long
+  for (FlowQueue::iterator i = receiver->second.begin (); i != receiver->second.end (); )
+    {
+      ConstIterator pos = *i++;
+      TtlExceeded (pos);
+    }
+  return receiver->second.size ();
+}
+
 void
 WifiMacQueue::ChangePacketsReceiverAddress (Mac48Address OriginalAddress, Mac48Address newAddress)
 {
@@ -474,6 +727,7 @@ WifiMacQueue::ChangePacketsReceiverAddress (Mac48Address OriginalAddress, Mac48A
           it++;
         }
     }
+  RebuildIndex ();
 }
 
 
@@ -25,8 +25,11 @@
 #define WIFI_MAC_QUEUE_H
 
 #include "ns3/queue.h"
+#include "ns3/traced-callback.h"
 #include "wifi-mac-queue-item.h"
 
+#include <list>
+#include <map>
 
 namespace ns3 {
 
@@ -46,6 +49,17 @@ class QosBlockedDestinations;
  * to verify whether or not it should be dropped. If
  * dot11EDCATableMSDULifetime has elapsed, it is dropped.
  * Otherwise, it is returned to the caller.
+ *
+ * Besides the FIFO order, QoS data frames are indexed per (receiver address, TID)
+ * flow, so that the lookups by TID and receiver address done while building
+ * A-MSDUs and A-MPDUs only visit the head of the flow instead of scanning the
+ * whole queue. Packets whose lifetime expired are removed lazily when they reach
+ * the head of their flow.
+ *
+ * All the frames are also indexed per receiver address. A DMG service period is
+ * allocated to a single peer station, so the frames that it can carry are found
+ * in the queue of that receiver without scanning the frames that can only be
+ * sent during a CBAP or a service period with another peer.
  */
 class WifiMacQueue : public Queue<WifiMacQueueItem>
 {
@@ -254,6 +268,19 @@ public:
    * \return true if the queue has at least one packet for the provided receiver address.
    */
   bool HasPacketsForReceiver (Mac48Address addr);
+  /**
+   * \param addr The MAC Address of the receiver.
+   * \return the number of packets in the queue for the provided receiver address.
+   */
+  uint32_t GetNPacketsForReceiver (Mac48Address addr);
+
+  /**
+   * TracedCallback signature for the backlog of a receiver.
+   *
+   * \param addr The MAC address of the receiver.
+   * \param packets The number of packets queued for the receiver.
+   */
+  typedef void (* BacklogTracedCallback)(Mac48Address addr, uint32_t packets);
 
 private:
   /**
@@ -266,6 +293,86 @@ private:
    */
   bool TtlExceeded (ConstIterator &it);
 
+  /// Flow identifier: the receiver address and the TID of QoS data frames
+  typedef std::pair<Mac48Address, uint8_t> FlowId;
+  /// The items of a flow in FIFO order
+  typedef std::list<ConstIterator> FlowQueue;
+  /// Map flows to their items
+  typedef std::map<FlowId, FlowQueue> Flows;
+  /// Map receiver addresses to their items, in FIFO order
+  typedef std::map<Mac48Address, FlowQueue> Receivers;
+
+  /**
+   * \param item the Wifi MAC queue item
+   * \param flow the flow of the item
+   * \return true if the item is a QoS data frame that belongs to a flow
+   */
+  static bool GetFlowId (Ptr<const WifiMacQueueItem> item, FlowId &flow);
+  /**
+   * Check whether the given lookup can be served by the flow index.
+   *
+   * \param type the given address type
+   * \return true if the lookup is by receiver address
+   */
+  static bool IsIndexed (WifiMacHeader::AddressType type);
+  /**
+   * Return the first item of a flow, after removing from the queue the items
+   * at the head of the flow that stayed in the queue for too long.
+   *
+   * \param tid the given TID
+   * \param addr the given receiver address
+   * \param it set to the position of the first item in the queue
+   * \return true if the flow has at least one item
+   */
+  bool GetFlowHead (uint8_t tid, Mac48Address addr, ConstIterator &it);
+  /**
+   * Return the first item for a receiver that satisfies the given QoS data
+   * frame lookup, after removing from the queue the items for that receiver
+   * that stayed in the queue for too long.
+   *
+   * \param addr the given receiver address
+   * \param blockedPackets the blocked destinations
+   * \param it set to the position of the item in the queue
+   * \return true if an item is found
+   */
+  bool GetFirstAvailableForReceiver (Mac48Address addr, const Ptr<QosBlockedDestinations> blockedPackets,
+                                     ConstIterator &it);
+  /**
+   * Remove the given item from the index of its flow and of its receiver.
+   *
+   * \param pos the position of the item in the queue
+   */
+  void RemoveFromIndex (ConstIterator pos);
+  /**
+   * Rebuild the flow and receiver indexes from the FIFO order of the queue.
+   */
+  void RebuildIndex (void);
+  /**
+   * Insert an item in the queue and in the indexes of its flow and receiver.
+   *
+   * \param pos the position before which the item is inserted
+   * \param item the item to insert
+   * \return true if success, false if the packet has been dropped
+   */
+  bool DoEnqueue (ConstIterator pos, Ptr<WifiMacQueueItem> item);
+  /**
+   * Dequeue an item from the queue and from the indexes of its flow and receiver.
+   *
+   * \param pos the position of the item
+   * \return the item
+   */
+  Ptr<WifiMacQueueItem> DoDequeue (ConstIterator pos);
+  /**
+   * Remove an item from the queue and from the indexes of its flow and receiver.
+   *
+   * \param pos the position of the item
+   * \return the item
+   */
+  Ptr<WifiMacQueueItem> DoRemove (ConstIterator pos);
+
+  Flows m_flows;                            //!< Per (receiver address, TID) index of the QoS data frames
+  Receivers m_receivers;                    //!< Per receiver address index of all the frames
+  TracedCallback<Mac48Address, uint32_t> m_backlogTrace; //!< Trace of the number of packets queued per receiver
   Time m_maxDelay;                          //!< Time to live for packets in the queue
   DropPolicy m_dropPolicy;                  //!< Drop behavior of queue
 
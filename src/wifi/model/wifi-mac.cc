@@ -143,6 +143,12 @@ WifiMac::GetCompressedBlockAckTimeout (void) const
   return MicroSeconds (0);
 }
 
+void
+WifiMac::SetForwardUpBurstCallback (Callback<void, const MsduAggregator::DeaggregatedMsdus &> upCallback)
+{
+  //this method must be implemented by WifiMacs receiving A-MSDUs
+}
+
 TypeId
 WifiMac::GetTypeId (void)
 {
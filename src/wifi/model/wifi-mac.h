@@ -26,6 +26,7 @@
 #include "dca-txop.h"
 #include "ssid.h"
 #include "qos-utils.h"
+#include "msdu-aggregator.h"
 
 namespace ns3 {
 
@@ -253,6 +254,12 @@ public:
    * \return the current compressed block ACK timeout duration.
    */
   virtual Time GetCompressedBlockAckTimeout (void) const;
+  /**
+   * \param upCallback the callback to invoke when the MSDUs of an A-MSDU must be
+   * forwarded up the stack at once. MACs which do not support it forward each MSDU
+   * through the callback set with SetForwardUpCallback.
+   */
+  virtual void SetForwardUpBurstCallback (Callback<void, const MsduAggregator::DeaggregatedMsdus &> upCallback);
 
   /**
    * \param packet the packet being enqueued
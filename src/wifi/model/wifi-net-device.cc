@@ -119,6 +119,7 @@ WifiNetDevice::CompleteConfig (void)
   m_mac->SetWifiRemoteStationManager (m_stationManager);
   m_mac->SetWifiPhy (m_phy);
   m_mac->SetForwardUpCallback (MakeCallback (&WifiNetDevice::ForwardUp, this));
+  m_mac->SetForwardUpBurstCallback (MakeCallback (&WifiNetDevice::ForwardUpBurst, this));
   m_mac->SetLinkUpCallback (MakeCallback (&WifiNetDevice::LinkUp, this));
   m_mac->SetLinkDownCallback (MakeCallback (&WifiNetDevice::LinkDown, this));
   m_stationManager->SetupPhy (m_phy);
@@ -379,6 +380,56 @@ WifiNetDevice::SetReceiveCallback (NetDevice::ReceiveCallback cb)
   m_forwardUp = cb;
 }
 
+void
+WifiNetDevice::SetReceiveBurstCallback (NetDevice::ReceiveBurstCallback cb)
+{
+  m_forwardUpBurst = cb;
+}
+
+void
+WifiNetDevice::ForwardUpBurst (const MsduAggregator::DeaggregatedMsdus &msdus)
+{
+  NS_LOG_FUNCTION (this << msdus.size ());
+  if (m_forwardUpBurst.IsNull () || !m_promiscRx.IsNull ())
+    {
+      /* Keep the promiscuous deliveries interleaved with the regular ones */
+      for (MsduAggregator::DeaggregatedMsdusCI i = msdus.begin (); i != msdus.end (); ++i)
+        {
+          ForwardUp ((*i).first, (*i).second.GetSourceAddr (), (*i).second.GetDestinationAddr ());
+        }
+      return;
+    }
+  Mac48Address self = m_mac->GetAddress ();
+  std::vector<Ptr<const Packet> > burst;
+  uint16_t protocol = 0;
+  Mac48Address sender;
+  for (MsduAggregator::DeaggregatedMsdusCI i = msdus.begin (); i != msdus.end (); ++i)
+    {
+      Mac48Address from = (*i).second.GetSourceAddr ();
+      Mac48Address to = (*i).second.GetDestinationAddr ();
+      if (!to.IsGroup () && to != self)
+        {
+          continue;
+        }
+      Ptr<Packet> packet = (*i).first;
+      LlcSnapHeader llc;
+      m_mac->NotifyRx (packet);
+      packet->RemoveHeader (llc);
+      if (!burst.empty () && (llc.GetType () != protocol || from != sender))
+        {
+          m_forwardUpBurst (this, burst, protocol, sender);
+          burst.clear ();
+        }
+      protocol = llc.GetType ();
+      sender = from;
+      burst.push_back (packet);
+    }
+  if (!burst.empty ())
+    {
+      m_forwardUpBurst (this, burst, protocol, sender);
+    }
+}
+
 void
 WifiNetDevice::ForwardUp (Ptr<Packet> packet, Mac48Address from, Mac48Address to)
 {
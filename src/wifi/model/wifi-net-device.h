@@ -24,6 +24,7 @@
 #include "ns3/net-device.h"
 #include "ns3/queue-item.h"
 #include "ns3/traced-callback.h"
+#include "msdu-aggregator.h"
 
 namespace ns3 {
 
@@ -105,6 +106,7 @@ public:
   void SetNode (const Ptr<Node> node);
   bool NeedsArp (void) const;
   void SetReceiveCallback (NetDevice::ReceiveCallback cb);
+  void SetReceiveBurstCallback (NetDevice::ReceiveBurstCallback cb);
   Address GetMulticast (Ipv6Address addr) const;
   bool SendFrom (Ptr<Packet> packet, const Address& source, const Address& dest, uint16_t protocolNumber);
   void SetPromiscReceiveCallback (PromiscReceiveCallback cb);
@@ -124,6 +126,14 @@ protected:
    * \param to
    */
   void ForwardUp (Ptr<Packet> packet, Mac48Address from, Mac48Address to);
+  /**
+   * Receive the MSDUs of an A-MSDU from the lower layer and pass them
+   * up the stack, in bursts of consecutive packets sharing the same
+   * protocol and sender.
+   *
+   * \param msdus the MSDUs and their subframe headers
+   */
+  void ForwardUpBurst (const MsduAggregator::DeaggregatedMsdus &msdus);
 
 
 private:
@@ -216,6 +226,7 @@ private:
   Ptr<WifiRemoteStationManager> m_stationManager; //!< the station manager
   Ptr<NetDeviceQueueInterface> m_queueInterface;   //!< NetDevice queue interface
   NetDevice::ReceiveCallback m_forwardUp; //!< forward up callback
+  NetDevice::ReceiveBurstCallback m_forwardUpBurst; //!< forward up burst callback
   NetDevice::PromiscReceiveCallback m_promiscRx; //!< promiscious receive callback
 
   TracedCallback<Ptr<const Packet>, Mac48Address> m_rxLogger; //!< receive trace callback
@@ -36,6 +36,9 @@ namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("WifiRemoteStationManager");
 
+/// The initial number of buckets of the station indexes, must be a power of two
+#define STATION_INDEX_INITIAL_BUCKETS 16
+
 /**
  * HighLatencyDataTxVectorTag class
  */
@@ -407,7 +410,9 @@ WifiRemoteStationManager::GetTypeId (void)
 }
 
 WifiRemoteStationManager::WifiRemoteStationManager ()
-  : m_qosSupported (false),
+  : m_stateIndex (STATION_INDEX_INITIAL_BUCKETS, 0),
+    m_stationIndex (STATION_INDEX_INITIAL_BUCKETS, 0),
+    m_qosSupported (false),
     m_htSupported (false),
     m_vhtSupported (false),
     m_heSupported (false),
@@ -1145,6 +1150,27 @@ WifiRemoteStationManager::ReportAmpduTxStatus (Mac48Address address, uint8_t tid
   DoReportAmpduTxStatus (station, nSuccessfulMpdus, nFailedMpdus, rxSnr, dataSnr);
 }
 
+void
+WifiRemoteStationManager::ReportBeamformingSnr (Mac48Address address, double snr)
+{
+  NS_LOG_FUNCTION (this << address << snr);
+  NS_ASSERT (!address.IsGroup ());
+  /* The beamformed link is shared by all the TIDs of the remote station */
+  bool found = false;
+  for (Stations::const_iterator i = m_stations.begin (); i != m_stations.end (); i++)
+    {
+      if ((*i)->m_state->m_address == address)
+        {
+          DoReportBeamformingSnr (*i, snr);
+          found = true;
+        }
+    }
+  if (!found)
+    {
+      DoReportBeamformingSnr (Lookup (address, static_cast<uint8_t> (0)), snr);
+    }
+}
+
 bool
 WifiRemoteStationManager::NeedRts (Mac48Address address, const WifiMacHeader *header,
                                    Ptr<const Packet> packet, WifiTxVector txVector)
@@ -1789,13 +1815,11 @@ WifiRemoteStationState *
 WifiRemoteStationManager::LookupState (Mac48Address address) const
 {
   NS_LOG_FUNCTION (this << address);
-  for (StationStates::const_iterator i = m_states.begin (); i != m_states.end (); i++)
+  uint32_t entry = m_stateIndex[FindStateBucket (address)];
+  if (entry != 0)
     {
-      if ((*i)->m_address == address)
-        {
-          NS_LOG_DEBUG ("WifiRemoteStationManager::LookupState returning existing state");
-          return (*i);
-        }
+      NS_LOG_DEBUG ("WifiRemoteStationManager::LookupState returning existing state");
+      return m_states[entry - 1];
     }
   WifiRemoteStationState *state = new WifiRemoteStationState ();
   state->m_state = WifiRemoteStationState::BRAND_NEW;
@@ -1817,6 +1841,7 @@ WifiRemoteStationManager::LookupState (Mac48Address address) const
   state->m_heSupported = false;
   state->m_dmgSupported = false;
   const_cast<WifiRemoteStationManager *> (this)->m_states.push_back (state);
+  const_cast<WifiRemoteStationManager *> (this)->IndexLastState ();
   NS_LOG_DEBUG ("WifiRemoteStationManager::LookupState returning new state");
   return state;
 }
@@ -1840,13 +1865,10 @@ WifiRemoteStation *
 WifiRemoteStationManager::Lookup (Mac48Address address, uint8_t tid) const
 {
   NS_LOG_FUNCTION (this << address << +tid);
-  for (Stations::const_iterator i = m_stations.begin (); i != m_stations.end (); i++)
+  uint32_t entry = m_stationIndex[FindStationBucket (address, tid)];
+  if (entry != 0)
     {
-      if ((*i)->m_tid == tid
-          && (*i)->m_state->m_address == address)
-        {
-          return (*i);
-        }
+      return m_stations[entry - 1];
     }
   WifiRemoteStationState *state = LookupState (address);
 
@@ -1856,9 +1878,86 @@ WifiRemoteStationManager::Lookup (Mac48Address address, uint8_t tid) const
   station->m_ssrc = 0;
   station->m_slrc = 0;
   const_cast<WifiRemoteStationManager *> (this)->m_stations.push_back (station);
+  const_cast<WifiRemoteStationManager *> (this)->IndexLastStation ();
   return station;
 }
 
+uint32_t
+WifiRemoteStationManager::Hash (Mac48Address address, uint8_t tid)
+{
+  uint8_t buffer[6];
+  address.CopyTo (buffer);
+  //FNV-1a over the six bytes of the address followed by the TID
+  uint32_t hash = 2166136261u;
+  for (uint8_t i = 0; i < 6; i++)
+    {
+      hash ^= buffer[i];
+      hash *= 16777619u;
+    }
+  hash ^= tid;
+  hash *= 16777619u;
+  return hash;
+}
+
+uint32_t
+WifiRemoteStationManager::FindStateBucket (Mac48Address address) const
+{
+  uint32_t mask = m_stateIndex.size () - 1;
+  uint32_t bucket = Hash (address, 0) & mask;
+  while (m_stateIndex[bucket] != 0 && m_states[m_stateIndex[bucket] - 1]->m_address != address)
+    {
+      bucket = (bucket + 1) & mask;
+    }
+  return bucket;
+}
+
+uint32_t
+WifiRemoteStationManager::FindStationBucket (Mac48Address address, uint8_t tid) const
+{
+  uint32_t mask = m_stationIndex.size () - 1;
+  uint32_t bucket = Hash (address, tid) & mask;
+  while (m_stationIndex[bucket] != 0)
+    {
+      const WifiRemoteStation *station = m_stations[m_stationIndex[bucket] - 1];
+      if (station->m_tid == tid && station->m_state->m_address == address)
+        {
+          break;
+        }
+      bucket = (bucket + 1) & mask;
+    }
+  return bucket;
+}
+
+void
+WifiRemoteStationManager::IndexLastState (void)
+{
+  if (2 * m_states.size () > m_stateIndex.size ())
+    {
+      NS_LOG_DEBUG ("Growing the station state index to " << 2 * m_stateIndex.size () << " buckets");
+      m_stateIndex.assign (2 * m_stateIndex.size (), 0);
+      for (uint32_t i = 0; i < m_states.size () - 1; i++)
+        {
+          m_stateIndex[FindStateBucket (m_states[i]->m_address)] = i + 1;
+        }
+    }
+  m_stateIndex[FindStateBucket (m_states.back ()->m_address)] = m_states.size ();
+}
+
+void
+WifiRemoteStationManager::IndexLastStation (void)
+{
+  if (2 * m_stations.size () > m_stationIndex.size ())
+    {
+      NS_LOG_DEBUG ("Growing the station index to " << 2 * m_stationIndex.size () << " buckets");
+      m_stationIndex.assign (2 * m_stationIndex.size (), 0);
+      for (uint32_t i = 0; i < m_stations.size () - 1; i++)
+        {
+          m_stationIndex[FindStationBucket (m_stations[i]->m_state->m_address, m_stations[i]->m_tid)] = i + 1;
+        }
+    }
+  m_stationIndex[FindStationBucket (m_stations.back ()->m_state->m_address, m_stations.back ()->m_tid)] = m_stations.size ();
+}
+
 void
 WifiRemoteStationManager::SetQosSupport (Mac48Address from, bool qosSupported)
 {
@@ -2024,6 +2123,8 @@ WifiRemoteStationManager::Reset (void)
       delete (*i);
     }
   m_stations.clear ();
+  m_stateIndex.assign (STATION_INDEX_INITIAL_BUCKETS, 0);
+  m_stationIndex.assign (STATION_INDEX_INITIAL_BUCKETS, 0);
   m_bssBasicRateSet.clear ();
   m_bssBasicMcsSet.clear ();
 }
@@ -2180,6 +2281,12 @@ WifiRemoteStationManager::DoReportAmpduTxStatus (WifiRemoteStation *station, uin
   NS_LOG_DEBUG ("DoReportAmpduTxStatus received but the manager does not handle A-MPDUs!");
 }
 
+void
+WifiRemoteStationManager::DoReportBeamformingSnr (WifiRemoteStation *station, double snr)
+{
+  NS_LOG_DEBUG ("DoReportBeamformingSnr received but the manager does not use it");
+}
+
 WifiMode
 WifiRemoteStationManager::GetSupported (const WifiRemoteStation *station, uint8_t i) const
 {
@@ -817,6 +817,14 @@ public:
    */
   void ReportRxOk (Mac48Address address, const WifiMacHeader *header,
                    double rxSnr, WifiMode txMode);
+  /**
+   * Should be invoked whenever a beamforming training (SLS or BRP) with a
+   * remote station completes.
+   *
+   * \param address remote address
+   * \param snr the SNR of the best antenna configuration found by the training
+   */
+  void ReportBeamformingSnr (Mac48Address address, double snr);
 
   /**
    * \param address remote address
@@ -1450,6 +1458,15 @@ private:
    * \param dataSnr data SNR reported by remote station
    */
   virtual void DoReportAmpduTxStatus (WifiRemoteStation *station, uint8_t nSuccessfulMpdus, uint8_t nFailedMpdus, double rxSnr, double dataSnr);
+  /**
+   * Called whenever a beamforming training with the remote station completes.
+   * This method is a virtual method that can be implemented by the sub-class
+   * intended to seed its rate selection from the beamforming training.
+   *
+   * \param station the station we trained the beam with
+   * \param snr the SNR of the best antenna configuration found by the training
+   */
+  virtual void DoReportBeamformingSnr (WifiRemoteStation *station, double snr);
 
   /**
    * Return the state of the station associated with the given address.
@@ -1478,6 +1495,40 @@ private:
    * \return WifiRemoteStation corresponding to the address
    */
   WifiRemoteStation* Lookup (Mac48Address address, const WifiMacHeader *header) const;
+  /**
+   * Hash the key of a station.
+   *
+   * \param address the address of the station
+   * \param tid the TID of the station
+   *
+   * \return the hash value of the key
+   */
+  static uint32_t Hash (Mac48Address address, uint8_t tid);
+  /**
+   * \param address the address of the station
+   *
+   * \return the bucket of m_stateIndex holding the address or the empty
+   * bucket where it should be inserted
+   */
+  uint32_t FindStateBucket (Mac48Address address) const;
+  /**
+   * \param address the address of the station
+   * \param tid the TID
+   *
+   * \return the bucket of m_stationIndex holding the station or the empty
+   * bucket where it should be inserted
+   */
+  uint32_t FindStationBucket (Mac48Address address, uint8_t tid) const;
+  /**
+   * Add the last element of m_states to the state index, the index is grown
+   * when it becomes half full.
+   */
+  void IndexLastState (void);
+  /**
+   * Add the last element of m_stations to the station index, the index is
+   * grown when it becomes half full.
+   */
+  void IndexLastStation (void);
 
   /**
    * Return whether the modulation class of the selected mode for the
@@ -1554,6 +1605,14 @@ private:
 
   StationStates m_states;  //!< States of known stations
   Stations m_stations;     //!< Information for each known stations
+  /**
+   * Open-addressing hash indexes over m_states and m_stations. Each bucket
+   * holds the position of the element in its vector plus one, zero being an
+   * empty bucket. Entries are never removed but by Reset (), so linear probing
+   * needs no tombstones.
+   */
+  std::vector<uint32_t> m_stateIndex;
+  std::vector<uint32_t> m_stationIndex; //!< Hash index over m_stations
 
   WifiMode m_defaultTxMode; //!< The default transmission mode
   WifiMode m_defaultTxMcs;   //!< The default transmission modulation-coding scheme (MCS)
@@ -26,6 +26,7 @@
 #include "ns3/system-wall-clock-ms.h"
 #include "ns3/packet.h"
 #include "ns3/packet-metadata.h"
+#include "ns3/packet-memory-pool.h"
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -328,6 +329,57 @@ benchByteTags (uint32_t n)
     }
 }
 
+static void
+benchDmg (uint32_t n)
+{
+  BenchHeader<25> ipv4;
+  BenchHeader<8> udp;
+  BenchHeader<32> mac;
+  BenchTag<16> phyTag;
+
+  /* n MPDUs carrying 7920-byte MSDUs, aggregated 32 at a time into A-MPDUs */
+  for (uint32_t i = 0; i < n; i += 32) {
+    Ptr<Packet> ampdu = Create<Packet> ();
+    for (uint32_t j = 0; j < 32; j++) {
+      Ptr<Packet> msdu = Create<Packet> (7920 - 33);
+      msdu->AddHeader (udp);
+      msdu->AddHeader (ipv4);
+      msdu->AddHeader (mac);
+      ampdu->AddAtEnd (msdu);
+    }
+    ampdu->AddPacketTag (phyTag);
+
+    /* Short control frames exchanged around the A-MPDU, e.g., SSW or Grant frames */
+    for (uint32_t j = 0; j < 4; j++) {
+      Ptr<Packet> control = Create<Packet> (26);
+      control->AddPacketTag (phyTag);
+    }
+
+    /* Each receiver of the channel gets its own copy */
+    for (uint32_t j = 0; j < 3; j++) {
+      Ptr<Packet> copy = ampdu->Copy ();
+      copy->RemovePacketTag (phyTag);
+    }
+  }
+}
+
+static void
+printPoolStatistics (void)
+{
+  static char const *names[PacketMemoryPool::CLIENT_COUNT] = {"buffer", "metadata", "tags"};
+  for (uint32_t i = 0; i < PacketMemoryPool::CLIENT_COUNT; i++)
+    {
+      PacketMemoryPool::Statistics stats = PacketMemoryPool::GetStatistics (static_cast<PacketMemoryPool::Client> (i));
+      std::cout << "  " << names[i]
+                << ": allocations=" << stats.allocations
+                << " reused=" << stats.reused
+                << " releases=" << stats.releases
+                << " recycled=" << stats.recycled
+                << std::endl;
+    }
+  std::cout << "  cached=" << PacketMemoryPool::GetCachedBytes () << " bytes" << std::endl;
+}
+
 static uint64_t
 runBenchOneIteration (void (*bench) (uint32_t), uint32_t n)
 {
@@ -340,8 +392,10 @@ runBenchOneIteration (void (*bench) (uint32_t), uint32_t n)
 
 
 static void
-runBench (void (*bench) (uint32_t), uint32_t n, uint32_t minIterations, char const *name)
+runBench (void (*bench) (uint32_t), uint32_t n, uint32_t minIterations, char const *name,
+          bool printPool)
 {
+  PacketMemoryPool::ResetStatistics ();
   uint64_t minDelay = std::numeric_limits<uint64_t>::max();
   for (uint32_t i = 0; i < minIterations; i++)
     {
@@ -355,6 +409,10 @@ runBench (void (*bench) (uint32_t), uint32_t n, uint32_t minIterations, char con
             << " (" << minDelay << " ms elapsed)\t"
             << name
             << std::endl;
+  if (printPool)
+    {
+      printPoolStatistics ();
+    }
 }
 
 int main (int argc, char *argv[])
@@ -362,12 +420,16 @@ int main (int argc, char *argv[])
   uint32_t n = 0;
   uint32_t minIterations = 1;
   bool enablePrinting = false;
+  bool disablePool = false;
+  bool printPool = false;
 
   CommandLine cmd;
   cmd.Usage ("Benchmark Packet class");
   cmd.AddValue ("n", "number of iterations", n);
   cmd.AddValue ("min-iterations", "number of subiterations to minimize iteration time over", minIterations);
   cmd.AddValue ("enable-printing", "enable packet printing", enablePrinting);
+  cmd.AddValue ("disable-pool", "do not recycle the packet memory", disablePool);
+  cmd.AddValue ("print-pool", "print the statistics of the packet memory pool", printPool);
   cmd.Parse (argc, argv);
 
   if (n == 0)
@@ -379,12 +441,15 @@ int main (int argc, char *argv[])
   std::cout << "Running bench-packets with n=" << n << std::endl;
   std::cout << "All tests begin by adding UDP and IPv4 headers." << std::endl;
 
-  runBench (&benchA, n, minIterations, "Copy packet, remove headers");
-  runBench (&benchB, n, minIterations, "Just add headers");
-  runBench (&benchC, n, minIterations, "Remove by func call");
-  runBench (&benchD, n, minIterations, "Intermixed add/remove headers and tags");
-  runBench (&benchFragment, n, minIterations, "Fragmentation and concatenation");
-  runBench (&benchByteTags, n, minIterations, "Benchmark byte tags");
+  PacketMemoryPool::SetEnabled (!disablePool);
+
+  runBench (&benchA, n, minIterations, "Copy packet, remove headers", printPool);
+  runBench (&benchB, n, minIterations, "Just add headers", printPool);
+  runBench (&benchC, n, minIterations, "Remove by func call", printPool);
+  runBench (&benchD, n, minIterations, "Intermixed add/remove headers and tags", printPool);
+  runBench (&benchFragment, n, minIterations, "Fragmentation and concatenation", printPool);
+  runBench (&benchByteTags, n, minIterations, "Benchmark byte tags", printPool);
+  runBench (&benchDmg, n, minIterations, "DMG A-MPDUs of 7920-byte MSDUs and control frames", printPool);
 
   return 0;
 }
@@ -22,9 +22,12 @@
 #include <iostream>
 #include <fstream>
 #include <vector>
+#include <unordered_set>
 #include <string.h>
+#include <sys/resource.h>
 
 #include "ns3/core-module.h"
+#include "ns3/event-trace-simulator-impl.h"
 
 using namespace ns3;
 
@@ -145,6 +148,129 @@ Bench::Cb (void)
 }
 
 
+/// Event of the replayed traces, never executed
+void
+ReplayEvent (void)
+{
+}
+
+/**
+ * Replay an event trace recorded by EventTraceSimulatorImpl against a scheduler.
+ *
+ * The trace is loaded first, so that only the operations on the scheduler
+ * are timed. The events inserted by ScheduleWithContext were recorded without
+ * uid, so they are given uids above those of the other events; a removal of an
+ * event that has already been executed because of this is ignored.
+ *
+ * \param filename the trace file
+ * \param factory the scheduler factory
+ * \param runs the number of runs
+ */
+void
+ReplayTrace (std::string filename, ObjectFactory factory, uint32_t runs)
+{
+  typedef EventTraceSimulatorImpl::Record Record;
+  std::ifstream input (filename.c_str (), std::ios::in | std::ios::binary);
+  if (!input.is_open () || !EventTraceSimulatorImpl::ReadHeader (input))
+    {
+      LOGME ("cannot read the event trace " << filename);
+      return;
+    }
+  std::vector<Record> records;
+  Record record;
+  while (EventTraceSimulatorImpl::ReadRecord (input, record))
+    {
+      records.push_back (record);
+    }
+  LOGME ("replaying " << records.size () << " records from " << filename);
+
+  LOG ("");
+  LOG (std::left << std::setw (g_fwidth) << "Run #" <<
+       std::left << std::setw (g_fwidth) << "Time (s)" <<
+       std::left << std::setw (g_fwidth) << "Rate (ev/s)" <<
+       std::left << std::setw (g_fwidth) << "Per (s/ev)" <<
+       std::left << std::setw (g_fwidth) << "Peak events" <<
+       std::left << std::setw (g_fwidth) << "Max RSS (KB)");
+
+  EventImpl *dummy = MakeEvent (&ReplayEvent);
+  for (uint32_t run = 0; run < runs; run++)
+    {
+      Ptr<Scheduler> scheduler = factory.Create<Scheduler> ();
+      std::unordered_set<uint32_t> live;
+      std::unordered_set<uint32_t> cancelled;
+      uint32_t contextUid = 0x80000000;
+      uint64_t executed = 0;
+      uint64_t pending = 0;
+      uint64_t peak = 0;
+      SystemWallClockMs time;
+
+      time.Start ();
+      for (std::vector<Record>::const_iterator i = records.begin (); i != records.end (); i++)
+        {
+          Scheduler::Event ev;
+          switch (i->type)
+            {
+            case EventTraceSimulatorImpl::INSERT:
+            case EventTraceSimulatorImpl::INSERT_CONTEXT:
+              ev.impl = dummy;
+              ev.key.m_ts = i->ts;
+              ev.key.m_context = i->context;
+              ev.key.m_uid = (i->type == EventTraceSimulatorImpl::INSERT) ? i->uid : contextUid++;
+              scheduler->Insert (ev);
+              live.insert (ev.key.m_uid);
+              peak = std::max (peak, ++pending);
+              break;
+            case EventTraceSimulatorImpl::CANCEL:
+              cancelled.insert (i->uid);
+              break;
+            case EventTraceSimulatorImpl::REMOVE:
+              if (live.erase (i->uid) != 0)
+                {
+                  ev.impl = dummy;
+                  ev.key.m_ts = i->ts;
+                  ev.key.m_context = i->context;
+                  ev.key.m_uid = i->uid;
+                  scheduler->Remove (ev);
+                  pending--;
+                }
+              break;
+            case EventTraceSimulatorImpl::EXECUTE:
+              /* The cancelled events are removed without being executed */
+              while (!scheduler->IsEmpty ())
+                {
+                  ev = scheduler->RemoveNext ();
+                  live.erase (ev.key.m_uid);
+                  pending--;
+                  if (cancelled.erase (ev.key.m_uid) == 0)
+                    {
+                      break;
+                    }
+                }
+              executed++;
+              break;
+            }
+        }
+      double simu = time.End () / 1000.0;
+
+      struct rusage usage;
+      getrusage (RUSAGE_SELF, &usage);
+      LOG (std::left << std::setw (g_fwidth) << run <<
+           std::left << std::setw (g_fwidth) << simu <<
+           std::left << std::setw (g_fwidth) << (executed / simu) <<
+           std::left << std::setw (g_fwidth) << (simu / executed) <<
+           std::left << std::setw (g_fwidth) << peak <<
+           std::left << std::setw (g_fwidth) << usage.ru_maxrss);
+
+      while (!scheduler->IsEmpty ())
+        {
+          scheduler->RemoveNext ();
+        }
+    }
+  dummy->Unref ();
+  LOG ("");
+}
+
+
 Ptr<RandomVariableStream>
 GetRandomStream (std::string filename)
 {
@@ -207,11 +333,14 @@ int main (int argc, char *argv[])
   bool schedHeap = false;
   bool schedList = false;
   bool schedMap  = true;
+  bool schedQuad = false;
+  bool pool      = true;
 
   uint32_t pop   =  100000;
   uint32_t total = 1000000;
   uint32_t runs  =       1;
   std::string filename = "";
+  std::string replay = "";
 
   CommandLine cmd;
   cmd.Usage ("Benchmark the simulator scheduler.\n"
@@ -221,16 +350,25 @@ int main (int argc, char *argv[])
              "  an ascii file, given by the --file=\"<filename>\" argument,\n"
              "  or standard input, by the argument --file=\"-\"\n"
              "In the case of either --file form, the input is expected\n"
-             "to be ascii, giving the relative event times in ns.");
+             "to be ascii, giving the relative event times in ns.\n"
+             "\n"
+             "Alternatively, --replay=\"<filename>\" replays against the scheduler\n"
+             "the event trace of a simulation recorded by ns3::EventTraceSimulatorImpl,\n"
+             "e.g. by running it with\n"
+             "  --SimulatorImplementationType=ns3::EventTraceSimulatorImpl\n"
+             "  --ns3::EventTraceSimulatorImpl::FileName=<filename>");
   cmd.AddValue ("cal",   "use CalendarSheduler",          schedCal);
   cmd.AddValue ("heap",  "use HeapScheduler",             schedHeap);
   cmd.AddValue ("list",  "use ListSheduler",              schedList);
   cmd.AddValue ("map",   "use MapScheduler (default)",    schedMap);
+  cmd.AddValue ("quad",  "use QuadHeapScheduler",         schedQuad);
+  cmd.AddValue ("pool",  "use the event pool (default)",  pool);
   cmd.AddValue ("debug", "enable debugging output",       g_debug);
   cmd.AddValue ("pop",   "event population size (default 1E5)",         pop);
   cmd.AddValue ("total", "total number of events to run (default 1E6)", total);
   cmd.AddValue ("runs",  "number of runs (default 1)",    runs);
   cmd.AddValue ("file",  "file of relative event times",  filename);
+  cmd.AddValue ("replay", "event trace to replay",        replay);
   cmd.AddValue ("prec",  "printed output precision",      g_fwidth);
   cmd.Parse (argc, argv);
   g_me = cmd.GetName () + ": ";
@@ -249,12 +387,24 @@ int main (int argc, char *argv[])
     {
       factory.SetTypeId ("ns3::ListScheduler");
     }
+  if (schedQuad)
+    {
+      factory.SetTypeId ("ns3::QuadHeapScheduler");
+    }
   Simulator::SetScheduler (factory);
+  EventImpl::SetPoolEnabled (pool);
 
   LOGME (std::setprecision (g_fwidth - 6));
   DEB ("debugging is ON");
 
   LOGME ("scheduler: " << factory.GetTypeId ().GetName ());
+  LOGME ("event pool: " << (pool ? "enabled" : "disabled"));
+
+  if (replay != "")
+    {
+      ReplayTrace (replay, factory, runs);
+      return 0;
+    }
   LOGME ("population: " << pop);
   LOGME ("total events: " << total);
   LOGME ("runs: " << runs);